@@ -0,0 +1,61 @@
+// Replacement of the whole global operator new and delete family (except the
+// over-aligned overloads, which the benchmarks do not use). Every overload goes
+// through the same pair, so each block is freed by the function matching its
+// allocation. It lives in its own translation unit so the compiler never
+// inlines delete next to a call it treats as the built-in operator new.
+
+#include "alloc_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> live{0};
+std::atomic<std::size_t> peak{0};
+
+} // namespace
+
+namespace alloc_counter {
+
+std::size_t liveBytes() { return live.load(); }
+std::size_t peakBytes() { return peak.load(); }
+void resetPeak() { peak = live.load(); }
+
+} // namespace alloc_counter
+
+void *operator new(std::size_t size) {
+    // The size is stored in front of the block so delete can subtract it
+    void *block = std::malloc(size + sizeof(std::max_align_t));
+    if (!block) throw std::bad_alloc();
+    *static_cast<std::size_t *>(block) = size;
+    std::size_t now = live += size;
+    std::size_t highest = peak.load();
+    while (now > highest && !peak.compare_exchange_weak(highest, now)) {}
+    return static_cast<char *>(block) + sizeof(std::max_align_t);
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    try {
+        return operator new(size);
+    } catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return operator new(size, std::nothrow); }
+
+void operator delete(void *p) noexcept {
+    if (!p) return;
+    void *block = static_cast<char *>(p) - sizeof(std::max_align_t);
+    live -= *static_cast<std::size_t *>(block);
+    std::free(block);
+}
+
+void operator delete[](void *p) noexcept { operator delete(p); }
+void operator delete(void *p, std::size_t) noexcept { operator delete(p); }
+void operator delete[](void *p, std::size_t) noexcept { operator delete(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { operator delete(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { operator delete(p); }
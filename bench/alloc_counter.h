@@ -0,0 +1,22 @@
+// Heap accounting for the benchmarks: alloc_counter.cpp replaces the global
+// operator new and delete family and keeps the live and peak byte counts.
+
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstddef>
+
+namespace alloc_counter {
+
+/// Bytes currently allocated through operator new.
+std::size_t liveBytes();
+
+/// Highest liveBytes() since the last resetPeak().
+std::size_t peakBytes();
+
+/// Start a new peak measurement from the current live bytes.
+void resetPeak();
+
+} // namespace alloc_counter
+
+#endif // ALLOC_COUNTER_H
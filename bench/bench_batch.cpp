@@ -0,0 +1,67 @@
+// Thread scaling of esAceptadaLote: one CompiledDFA shared by every thread of
+// a ThreadPool, validating a batch of random strings.
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "CompiledDFA.h"
+#include "ThreadPool.h"
+#include "validacion_cadenas.h"
+
+namespace {
+
+// Strings over {a, b} whose number of 'a's minus twice the number of 'b's is
+// divisible by 7
+Transition modSeven() {
+    Transition t;
+    for (int i = 0; i < 7; ++i) {
+        std::string from = "r" + std::to_string(i);
+        t.addTransition(from, 'a', "r" + std::to_string((i + 1) % 7));
+        t.addTransition(from, 'b', "r" + std::to_string((i + 5) % 7));
+    }
+    return t;
+}
+
+std::vector<std::string> randomBatch(size_t count, size_t length) {
+    std::mt19937 rng(3);
+    std::vector<std::string> batch(count, std::string(length, 'a'));
+    for (auto &s : batch) {
+        for (char &c : s) c = (rng() & 1) ? 'a' : 'b';
+    }
+    return batch;
+}
+
+constexpr size_t BATCH = 50000;
+constexpr size_t LENGTH = 256;
+
+void BM_BatchThreads(benchmark::State &state) {
+    Transition t = modSeven();
+    CompiledDFA dfa(t, "r0", {"r0"});
+    std::vector<std::string> batch = randomBatch(BATCH, LENGTH);
+    ThreadPool pool(static_cast<unsigned>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<std::uint64_t> bits = esAceptadaLote(dfa, batch.data(), batch.size(), pool);
+        benchmark::DoNotOptimize(bits.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BATCH));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(BATCH * LENGTH));
+}
+BENCHMARK(BM_BatchThreads)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Baseline: the single-threaded esAceptada loop the batch API replaces
+void BM_SequentialLoop(benchmark::State &state) {
+    Transition t = modSeven();
+    CompiledDFA dfa(t, "r0", {"r0"});
+    std::vector<std::string> batch = randomBatch(BATCH, LENGTH);
+    for (auto _ : state) {
+        size_t accepted = 0;
+        for (const std::string &s : batch) accepted += esAceptada(dfa, s);
+        benchmark::DoNotOptimize(accepted);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BATCH));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(BATCH * LENGTH));
+}
+BENCHMARK(BM_SequentialLoop)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace
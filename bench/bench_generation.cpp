@@ -0,0 +1,128 @@
+// Peak memory and throughput of generarCadenasConLimite against the previous
+// breadth-first version, which copied a map<string,int> of visits into every
+// queue node. Allocations are tracked by alloc_counter.cpp.
+// Also: thread scaling of the parallel shortlex generator at length 12.
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+#include "alloc_counter.h"
+#include "ParallelGeneration.h"
+#include "ThreadPool.h"
+#include "validacion_cadenas.h"
+
+namespace {
+
+// Three states fully connected on {a, b, c}: every path is a cycle, so the
+// visit limit is what bounds the search
+Transition cycles() {
+    Transition t;
+    const char symbols[] = {'a', 'b', 'c'};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            t.addTransition("c" + std::to_string(i), symbols[j], "c" + std::to_string((i + j) % 3));
+        }
+    }
+    return t;
+}
+
+// The previous implementation, kept verbatim as the baseline
+std::vector<std::string> generarConLimiteAnterior(const Transition &t,
+                                                  const std::string &estadoInicial,
+                                                  const std::set<std::string> &estadosFinales,
+                                                  const std::vector<char> &alfabeto,
+                                                  int longitudMaxima,
+                                                  int limiteCiclos) {
+    std::vector<std::string> cadenasAceptadas;
+    struct Exploracion {
+        std::string estado;
+        std::string cadena;
+        std::map<std::string, int> visitas;
+    };
+    std::queue<Exploracion> cola;
+    if (estadosFinales.count(estadoInicial)) cadenasAceptadas.push_back("");
+
+    Exploracion inicial;
+    inicial.estado = estadoInicial;
+    inicial.visitas[estadoInicial] = 1;
+    cola.push(inicial);
+    while (!cola.empty()) {
+        Exploracion actual = cola.front();
+        cola.pop();
+        if (static_cast<int>(actual.cadena.size()) >= longitudMaxima) continue;
+        for (char simbolo : alfabeto) {
+            for (StateId destino : t.getNextStateIds(actual.estado, simbolo)) {
+                const std::string &siguienteEstado = t.getStateName(destino);
+                Exploracion nueva;
+                nueva.estado = siguienteEstado;
+                nueva.cadena = actual.cadena + simbolo;
+                nueva.visitas = actual.visitas;
+                nueva.visitas[siguienteEstado]++;
+                if (nueva.visitas[siguienteEstado] > limiteCiclos) continue;
+                if (estadosFinales.count(siguienteEstado)) cadenasAceptadas.push_back(nueva.cadena);
+                if (static_cast<int>(nueva.cadena.size()) < longitudMaxima) cola.push(nueva);
+            }
+        }
+    }
+    return cadenasAceptadas;
+}
+
+const std::vector<char> ALPHABET = {'a', 'b', 'c'};
+const std::set<std::string> FINALS = {"c0"};
+
+void BM_GenerarConLimiteAnterior(benchmark::State &state) {
+    Transition t = cycles();
+    std::size_t produced = 0;
+    alloc_counter::resetPeak();
+    const std::size_t base = alloc_counter::liveBytes();
+    for (auto _ : state) {
+        std::vector<std::string> out = generarConLimiteAnterior(t, "c0", FINALS, ALPHABET,
+                                                                static_cast<int>(state.range(0)), 4);
+        produced += out.size();
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(produced));
+    state.counters["peak_bytes"] = static_cast<double>(alloc_counter::peakBytes() - base);
+}
+BENCHMARK(BM_GenerarConLimiteAnterior)->Arg(8)->Arg(10)->Arg(12)->Unit(benchmark::kMillisecond);
+
+void BM_GenerarConLimite(benchmark::State &state) {
+    Transition t = cycles();
+    std::size_t produced = 0;
+    alloc_counter::resetPeak();
+    const std::size_t base = alloc_counter::liveBytes();
+    for (auto _ : state) {
+        std::vector<std::string> out = generarCadenasConLimite(t, "c0", FINALS, ALPHABET,
+                                                               static_cast<int>(state.range(0)), 4);
+        produced += out.size();
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(produced));
+    state.counters["peak_bytes"] = static_cast<double>(alloc_counter::peakBytes() - base);
+}
+BENCHMARK(BM_GenerarConLimite)->Arg(8)->Arg(10)->Arg(12)->Unit(benchmark::kMillisecond);
+
+// Strings over {a, b, c} with no "cc" factor, up to length 12 (~450k strings)
+void BM_GenerateParallel(benchmark::State &state) {
+    Transition t;
+    t.addTransition("x", 'a', "x");
+    t.addTransition("x", 'b', "x");
+    t.addTransition("x", 'c', "y");
+    t.addTransition("y", 'a', "x");
+    t.addTransition("y", 'b', "x");
+    CompiledDFA dfa(t, "x", {"x", "y"});
+    ThreadPool pool(static_cast<unsigned>(state.range(0)));
+    std::size_t produced = 0;
+    for (auto _ : state) {
+        std::vector<std::string> out = generateShortlexParallel(dfa, ALPHABET, 12, pool);
+        produced += out.size();
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(produced));
+}
+BENCHMARK(BM_GenerateParallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace
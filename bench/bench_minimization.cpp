@@ -0,0 +1,81 @@
+// Benchmarks for Hopcroft minimization: state reduction and the effect of the
+// smaller automaton on later membership queries.
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "CompiledDFA.h"
+#include "Minimization.h"
+#include "validacion_cadenas.h"
+
+namespace {
+
+// n-state cycle where 'a' adds 1 and 'b' adds 2 modulo n, accepting every 4th
+// state. Only the value modulo 4 matters, so the minimal DFA has 4 states.
+DeterministicAutomaton redundantCycle(int n) {
+    DeterministicAutomaton dfa;
+    dfa.initialState = "p0";
+    for (int i = 0; i < n; ++i) {
+        std::string from = "p" + std::to_string(i);
+        dfa.delta.addTransition(from, 'a', "p" + std::to_string((i + 1) % n));
+        dfa.delta.addTransition(from, 'b', "p" + std::to_string((i + 2) % n));
+        if (i % 4 == 0) dfa.finalStates.insert(from);
+    }
+    return dfa;
+}
+
+std::vector<std::string> randomInputs(size_t count, size_t length) {
+    std::mt19937 rng(42);
+    std::vector<std::string> inputs(count, std::string(length, 'a'));
+    for (auto &s : inputs) {
+        for (char &c : s) c = (rng() & 1) ? 'a' : 'b';
+    }
+    return inputs;
+}
+
+void BM_Minimize(benchmark::State &state) {
+    DeterministicAutomaton dfa = redundantCycle(static_cast<int>(state.range(0)));
+    size_t after = 0;
+    for (auto _ : state) {
+        MinimizationResult result = minimize(dfa);
+        after = result.automaton.delta.getStateCount();
+        benchmark::DoNotOptimize(after);
+    }
+    state.counters["states_before"] = static_cast<double>(dfa.delta.getStateCount());
+    state.counters["states_after"] = static_cast<double>(after);
+}
+BENCHMARK(BM_Minimize)->Arg(400)->Arg(4000)->Arg(40000);
+
+// esAceptada on the original vs. the minimized automaton
+void BM_EsAceptada(benchmark::State &state, bool minimized) {
+    DeterministicAutomaton dfa = redundantCycle(static_cast<int>(state.range(0)));
+    if (minimized) dfa = minimize(dfa).automaton;
+    std::vector<std::string> inputs = randomInputs(256, 64);
+    for (auto _ : state) {
+        for (const auto &s : inputs) {
+            benchmark::DoNotOptimize(esAceptada(dfa.delta, dfa.initialState, dfa.finalStates, s));
+        }
+    }
+    state.counters["states"] = static_cast<double>(dfa.delta.getStateCount());
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+BENCHMARK_CAPTURE(BM_EsAceptada, original, false)->Arg(400)->Arg(4000);
+BENCHMARK_CAPTURE(BM_EsAceptada, minimized, true)->Arg(400)->Arg(4000);
+
+// Compiled table walk: the minimized table fits in a few cache lines
+void BM_CompiledAccepts(benchmark::State &state, bool minimized) {
+    DeterministicAutomaton dfa = redundantCycle(static_cast<int>(state.range(0)));
+    if (minimized) dfa = minimize(dfa).automaton;
+    CompiledDFA compiled(dfa.delta, dfa.initialState, dfa.finalStates);
+    std::vector<std::string> inputs = randomInputs(256, 64);
+    for (auto _ : state) {
+        for (const auto &s : inputs) benchmark::DoNotOptimize(compiled.accepts(s));
+    }
+    state.counters["table_bytes"] = static_cast<double>(compiled.getTableBytes());
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+BENCHMARK_CAPTURE(BM_CompiledAccepts, original, false)->Arg(400)->Arg(40000);
+BENCHMARK_CAPTURE(BM_CompiledAccepts, minimized, true)->Arg(400)->Arg(40000);
+
+} // namespace
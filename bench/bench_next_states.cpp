@@ -0,0 +1,84 @@
+// Benchmarks for the transition lookup: the copying getNextStates(string) API
+// against the getNextStateIds() view, reporting heap allocations per symbol.
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "Transition.h"
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+}
+
+// Count every heap allocation made by the process
+void *operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// GCC cannot see that these pair with the replaced operator new above
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// Cycle of n states with names too long for the small-string buffer; 'a'
+// advances by one and also branches to the state two ahead.
+Transition branchingCycle(int n) {
+    Transition t;
+    for (int i = 0; i < n; ++i) {
+        std::string from = "automaton_state_" + std::to_string(i);
+        t.addTransition(from, 'a', "automaton_state_" + std::to_string((i + 1) % n));
+        t.addTransition(from, 'a', "automaton_state_" + std::to_string((i + 2) % n));
+    }
+    return t;
+}
+
+constexpr int STATES = 64;
+constexpr int SYMBOLS = 1024;
+
+void reportAllocations(benchmark::State &state, std::size_t before) {
+    double symbols = static_cast<double>(state.iterations()) * SYMBOLS;
+    state.counters["allocs_per_symbol"] = (allocations.load() - before) / symbols;
+    state.SetItemsProcessed(static_cast<int64_t>(symbols));
+}
+
+void BM_StepCopyingNames(benchmark::State &state) {
+    Transition t = branchingCycle(STATES);
+    const std::string start = "automaton_state_0";
+    std::size_t before = allocations.load();
+    for (auto _ : state) {
+        std::string current = start;
+        for (int i = 0; i < SYMBOLS; ++i) {
+            std::vector<std::string> next = t.getNextStates(current, 'a');
+            current = next.back();
+        }
+        benchmark::DoNotOptimize(current);
+    }
+    reportAllocations(state, before);
+}
+BENCHMARK(BM_StepCopyingNames);
+
+void BM_StepIdView(benchmark::State &state) {
+    Transition t = branchingCycle(STATES);
+    const std::string &start = t.getStateName(t.getStateId("automaton_state_0"));
+    std::size_t before = allocations.load();
+    for (auto _ : state) {
+        const std::string *current = &start;
+        for (int i = 0; i < SYMBOLS; ++i) {
+            StateSpan next = t.getNextStateIds(*current, 'a');
+            current = &t.getStateName(next[next.size() - 1]);
+        }
+        benchmark::DoNotOptimize(current);
+    }
+    reportAllocations(state, before);
+}
+BENCHMARK(BM_StepIdView);
+
+} // namespace
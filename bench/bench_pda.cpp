@@ -0,0 +1,231 @@
+// PDA::accepts against the original search, which scanned every transition,
+// compared state names, copied the whole stack and rendered it to a string
+// at each configuration.
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <set>
+#include <stack>
+#include <string>
+#include <vector>
+#include "AdP.h"
+
+namespace {
+
+// The search as it was before the transition index and the shared stack,
+// kept here as the baseline
+class LegacyPDA {
+public:
+    LegacyPDA(std::string initial, char bottom) : initialState(std::move(initial)), bottom(bottom) {}
+    void addTransition(const PDA_Transition &t) { transitions.push_back(t); }
+    void addFinalState(const std::string &s) { finalStates.insert(s); }
+
+    bool accepts(const std::string &input, int maxSteps = 100000) const {
+        Config start{initialState, 0, {}};
+        start.stack.push(bottom);
+        std::vector<PDA_Step> pathSoFar, resultPath;
+        int stepsRemaining = maxSteps;
+        return dfs(input, start, pathSoFar, resultPath, stepsRemaining);
+    }
+
+private:
+    struct Config {
+        std::string state;
+        int inputIndex;
+        std::stack<char> stack;
+    };
+
+    std::string initialState;
+    char bottom;
+    std::vector<PDA_Transition> transitions;
+    std::set<std::string> finalStates;
+
+    bool dfs(const std::string &input, Config current, std::vector<PDA_Step> &pathSoFar,
+             std::vector<PDA_Step> &resultPath, int &stepsRemaining) const {
+        if (stepsRemaining-- <= 0) return false;
+        if (current.inputIndex == (int)input.size() && finalStates.count(current.state)) {
+            resultPath = pathSoFar;
+            return true;
+        }
+        for (const auto &t : transitions) {
+            if (t.from != current.state) continue;
+            bool inputMatches = t.input == '\0' ||
+                                (current.inputIndex < (int)input.size() && input[current.inputIndex] == t.input);
+            if (!inputMatches) continue;
+            std::stack<char> newStack = current.stack;
+            char popped = '\0';
+            if (t.pop != '\0') {
+                if (newStack.empty() || newStack.top() != t.pop) continue;
+                popped = newStack.top();
+                newStack.pop();
+            }
+            for (auto it = t.push.rbegin(); it != t.push.rend(); ++it) newStack.push(*it);
+
+            PDA_Step step{current.state, t.to, t.input, popped, t.push, PDA::stackToString(newStack),
+                          current.inputIndex + (t.input == '\0' ? 0 : 1)};
+            Config next{t.to, step.inputIndex, newStack};
+            pathSoFar.push_back(step);
+            if (dfs(input, next, pathSoFar, resultPath, stepsRemaining)) return true;
+            pathSoFar.pop_back();
+        }
+        return false;
+    }
+};
+
+constexpr int LETTERS = 20;
+
+// Marked palindromes w c w^R over 20 letters: one push move per (letter, top)
+// pair, so 462 transitions in total, the size of a small grammar turned into a PDA
+template <typename Automaton>
+Automaton markedPalindromes() {
+    Automaton pda("push", 'Z');
+    std::string tops = "Z";
+    for (int i = 0; i < LETTERS; ++i) tops.push_back(static_cast<char>('a' + i));
+    for (int i = 0; i < LETTERS; ++i) {
+        char letter = static_cast<char>('a' + i);
+        for (char top : tops) pda.addTransition({"push", letter, top, std::string{letter, top}, "push"});
+    }
+    for (char top : tops) pda.addTransition({"push", '#', top, std::string(1, top), "pop"});
+    for (int i = 0; i < LETTERS; ++i) {
+        char letter = static_cast<char>('a' + i);
+        pda.addTransition({"pop", letter, letter, "", "pop"});
+    }
+    pda.addTransition({"pop", '\0', 'Z', "Z", "accept"});
+    pda.addFinalState("accept");
+    return pda;
+}
+
+// Even palindromes w w^R: the PDA has to guess the middle, so the search
+// backtracks out of every deeper guess, each one holding a long stack
+template <typename Automaton>
+Automaton evenPalindromes() {
+    Automaton pda("push", 'Z');
+    std::string tops = "Z";
+    for (int i = 0; i < LETTERS; ++i) tops.push_back(static_cast<char>('a' + i));
+    for (int i = 0; i < LETTERS; ++i) {
+        char letter = static_cast<char>('a' + i);
+        for (char top : tops) pda.addTransition({"push", letter, top, std::string{letter, top}, "push"});
+    }
+    pda.addTransition({"push", '\0', '\0', "", "pop"});
+    for (int i = 0; i < LETTERS; ++i) {
+        char letter = static_cast<char>('a' + i);
+        pda.addTransition({"pop", letter, letter, "", "pop"});
+    }
+    pda.addTransition({"pop", '\0', 'Z', "Z", "accept"});
+    pda.addFinalState("accept");
+    return pda;
+}
+
+std::string markedPalindrome(size_t half) {
+    std::mt19937 rng(13);
+    std::string w(half, 'a');
+    for (char &c : w) c = static_cast<char>('a' + rng() % LETTERS);
+    return w + "#" + std::string(w.rbegin(), w.rend());
+}
+
+void BM_Accepts(benchmark::State &state) {
+    PDA pda = markedPalindromes<PDA>();
+    const std::string input = markedPalindrome(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(pda.accepts(input));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_Accepts)->Arg(16)->Arg(128)->Arg(1024);
+
+// Same search, also building the PDA_Step list of the accepting path
+void BM_AcceptsWithPath(benchmark::State &state) {
+    PDA pda = markedPalindromes<PDA>();
+    const std::string input = markedPalindrome(static_cast<size_t>(state.range(0)));
+    std::vector<PDA_Step> path;
+    for (auto _ : state) benchmark::DoNotOptimize(pda.accepts(input, &path));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_AcceptsWithPath)->Arg(16)->Arg(128)->Arg(1024);
+
+void BM_AcceptsLegacyScan(benchmark::State &state) {
+    LegacyPDA pda = markedPalindromes<LegacyPDA>();
+    const std::string input = markedPalindrome(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(pda.accepts(input));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_AcceptsLegacyScan)->Arg(16)->Arg(128)->Arg(1024);
+
+void BM_GuessMiddle(benchmark::State &state) {
+    PDA pda = evenPalindromes<PDA>();
+    std::string input = markedPalindrome(static_cast<size_t>(state.range(0)));
+    input.erase(input.find('#'), 1);
+    for (auto _ : state) benchmark::DoNotOptimize(pda.accepts(input));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_GuessMiddle)->Arg(16)->Arg(64)->Arg(128);
+
+// Same language with the other strategies; both return the shortest path
+void BM_GuessMiddleStrategy(benchmark::State &state) {
+    PDA pda = evenPalindromes<PDA>();
+    std::string input = markedPalindrome(static_cast<size_t>(state.range(1)));
+    input.erase(input.find('#'), 1);
+    PDA_SearchOptions options;
+    options.strategy = static_cast<PDA_SearchStrategy>(state.range(0));
+    PDA_SearchResult result;
+    for (auto _ : state) {
+        result = pda.search(input, options);
+        benchmark::DoNotOptimize(result.accepted);
+    }
+    state.counters["steps"] = result.steps;
+    state.counters["peak"] = static_cast<double>(result.peakConfigurations);
+}
+BENCHMARK(BM_GuessMiddleStrategy)
+    ->ArgNames({"strategy", "half"})
+    ->ArgsProduct({{static_cast<int>(PDA_SearchStrategy::DepthFirst),
+                    static_cast<int>(PDA_SearchStrategy::BreadthFirst),
+                    static_cast<int>(PDA_SearchStrategy::IterativeDeepening)},
+                   {16, 64}});
+
+// A row of ε-diamonds in front of a move the input never takes: 2^n paths
+// through n * 3 + 1 distinct configurations
+PDA epsilonDiamonds(int count) {
+    PDA pda("d0", 'Z');
+    for (int i = 0; i < count; ++i) {
+        std::string from = "d" + std::to_string(i), to = "d" + std::to_string(i + 1);
+        pda.addTransition({from, '\0', '\0', "", from + "l"});
+        pda.addTransition({from, '\0', '\0', "", from + "r"});
+        pda.addTransition({from + "l", '\0', '\0', "", to});
+        pda.addTransition({from + "r", '\0', '\0', "", to});
+    }
+    pda.addTransition({"d" + std::to_string(count), 'a', 'Z', "Z", "f"});
+    pda.addFinalState("f");
+    return pda;
+}
+
+// Rejections with and without the table of visited configurations
+void BM_Memoize(benchmark::State &state) {
+    const bool diamonds = state.range(1) == 0;
+    PDA pda = diamonds ? epsilonDiamonds(16) : evenPalindromes<PDA>();
+    std::string input = "b";
+    if (!diamonds) {
+        input = markedPalindrome(32);
+        input.back() = input.back() == 'a' ? 'b' : 'a';
+        input.erase(input.find('#'), 1);
+    }
+    PDA_SearchOptions options;
+    options.memoize = state.range(0) != 0;
+    options.maxSteps = 10000000;
+    PDA_SearchResult result;
+    for (auto _ : state) {
+        result = pda.search(input, options);
+        benchmark::DoNotOptimize(result.accepted);
+    }
+    state.counters["steps"] = result.steps;
+    state.counters["pruned"] = static_cast<double>(result.prunedConfigurations);
+}
+BENCHMARK(BM_Memoize)->ArgNames({"memo", "guessMiddle"})->ArgsProduct({{0, 1}, {0, 1}});
+
+void BM_GuessMiddleLegacyScan(benchmark::State &state) {
+    LegacyPDA pda = evenPalindromes<LegacyPDA>();
+    std::string input = markedPalindrome(static_cast<size_t>(state.range(0)));
+    input.erase(input.find('#'), 1);
+    for (auto _ : state) benchmark::DoNotOptimize(pda.accepts(input));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_GuessMiddleLegacyScan)->Arg(16)->Arg(64)->Arg(128);
+
+} // namespace
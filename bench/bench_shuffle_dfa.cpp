@@ -0,0 +1,79 @@
+// Throughput of the ShuffleDFA kernels against the scalar table walk of
+// CompiledDFA, on a 15-state automaton over random lowercase input.
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include "CompiledDFA.h"
+#include "ShuffleDFA.h"
+
+namespace {
+
+// Random complete DFA with 15 states over 'a'..'z' (16 rows with the dead state)
+CompiledDFA randomSmallDFA() {
+    std::mt19937 rng(5);
+    Transition t;
+    std::set<std::string> finals;
+    for (int i = 0; i < 15; ++i) {
+        std::string from = "q" + std::to_string(i);
+        for (char c = 'a'; c <= 'z'; ++c) t.addTransition(from, c, "q" + std::to_string(rng() % 15));
+        if (rng() & 1) finals.insert(from);
+    }
+    return CompiledDFA(t, "q0", finals);
+}
+
+std::string randomInput(size_t length) {
+    std::mt19937 rng(9);
+    std::string s(length, 'a');
+    for (char &c : s) c = static_cast<char>('a' + rng() % 26);
+    return s;
+}
+
+void BM_TableWalk(benchmark::State &state) {
+    const CompiledDFA dfa = randomSmallDFA();
+    const std::string input = randomInput(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dfa.runTable(dfa.getInitialState(), input.data(), input.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_TableWalk)->Arg(16)->Arg(64)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+void runKernel(benchmark::State &state, ShuffleDFA::Kernel kernel) {
+    if (!ShuffleDFA::isSupported(kernel)) {
+        state.SkipWithError("kernel not supported by this CPU");
+        return;
+    }
+    const CompiledDFA dfa = randomSmallDFA();
+    const ShuffleDFA shuffle(dfa, kernel);
+    const std::string input = randomInput(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(shuffle.run(dfa.getInitialState(), input.data(), input.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+
+void BM_ShuffleScalar(benchmark::State &state) { runKernel(state, ShuffleDFA::Kernel::Scalar); }
+BENCHMARK(BM_ShuffleScalar)->Arg(16)->Arg(64)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_ShuffleSse42(benchmark::State &state) { runKernel(state, ShuffleDFA::Kernel::Sse42); }
+BENCHMARK(BM_ShuffleSse42)->Arg(16)->Arg(64)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_ShuffleAvx2(benchmark::State &state) { runKernel(state, ShuffleDFA::Kernel::Avx2); }
+BENCHMARK(BM_ShuffleAvx2)->Arg(16)->Arg(64)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_ShuffleNeon(benchmark::State &state) { runKernel(state, ShuffleDFA::Kernel::Neon); }
+BENCHMARK(BM_ShuffleNeon)->Arg(16)->Arg(64)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+// What callers get: run() dispatches on state count and input length
+void BM_CompiledRun(benchmark::State &state) {
+    const CompiledDFA dfa = randomSmallDFA();
+    const std::string input = randomInput(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dfa.run(dfa.getInitialState(), input.data(), input.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_CompiledRun)->Arg(16)->Arg(64)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+} // namespace
@@ -0,0 +1,114 @@
+// Benchmarks for the storage behind Transition: the flat open-addressing table
+// against the previous std::unordered_map<TransKey, std::vector<StateId>>.
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "Transition.h"
+
+namespace {
+
+// The hash Transition used before the flat table
+struct IdentityKeyHash {
+    size_t operator()(const TransKey &k) const {
+        return std::hash<std::uint64_t>()((static_cast<std::uint64_t>(k.state) << 8) |
+                                          static_cast<unsigned char>(k.symbol));
+    }
+};
+
+using NodeMap = std::unordered_map<TransKey, std::vector<StateId>, IdentityKeyHash>;
+
+struct Edge {
+    StateId from;
+    char symbol;
+    StateId to;
+};
+
+// n random transitions over n/8 states and the symbols 'a'..'h'
+std::vector<Edge> randomEdges(size_t n) {
+    std::mt19937 rng(7);
+    StateId states = static_cast<StateId>(n / 8);
+    std::vector<Edge> edges(n);
+    for (Edge &e : edges) {
+        e = {static_cast<StateId>(rng() % states), static_cast<char>('a' + rng() % 8),
+             static_cast<StateId>(rng() % states)};
+    }
+    return edges;
+}
+
+// Queries over 'a'..'p', so roughly half of them miss
+std::vector<TransKey> randomQueries(size_t n, size_t count) {
+    std::mt19937 rng(11);
+    StateId states = static_cast<StateId>(n / 8);
+    std::vector<TransKey> queries(count);
+    for (TransKey &q : queries) {
+        q = {static_cast<StateId>(rng() % states), static_cast<char>('a' + rng() % 16)};
+    }
+    return queries;
+}
+
+Transition buildTable(const std::vector<Edge> &edges, size_t n) {
+    Transition t;
+    for (size_t i = 0; i < n / 8; ++i) t.internState("q" + std::to_string(i));
+    for (const Edge &e : edges) t.addTransition(e.from, e.symbol, e.to);
+    return t;
+}
+
+void BM_InsertFlatTable(benchmark::State &state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<Edge> edges = randomEdges(n);
+    for (auto _ : state) {
+        Transition t;
+        for (const Edge &e : edges) t.addTransition(e.from, e.symbol, e.to);
+        benchmark::DoNotOptimize(t);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_InsertFlatTable)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+void BM_InsertNodeMap(benchmark::State &state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<Edge> edges = randomEdges(n);
+    for (auto _ : state) {
+        NodeMap m;
+        for (const Edge &e : edges) m[{e.from, e.symbol}].push_back(e.to);
+        benchmark::DoNotOptimize(m);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_InsertNodeMap)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+constexpr size_t QUERIES = 1 << 16;
+
+void BM_LookupFlatTable(benchmark::State &state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Transition t = buildTable(randomEdges(n), n);
+    std::vector<TransKey> queries = randomQueries(n, QUERIES);
+    for (auto _ : state) {
+        size_t found = 0;
+        for (const TransKey &q : queries) found += t.getNextStates(q.state, q.symbol).size();
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(QUERIES));
+}
+BENCHMARK(BM_LookupFlatTable)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+void BM_LookupNodeMap(benchmark::State &state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    NodeMap m;
+    for (const Edge &e : randomEdges(n)) m[{e.from, e.symbol}].push_back(e.to);
+    std::vector<TransKey> queries = randomQueries(n, QUERIES);
+    for (auto _ : state) {
+        size_t found = 0;
+        for (const TransKey &q : queries) {
+            auto it = m.find(q);
+            if (it != m.end()) found += it->second.size();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(QUERIES));
+}
+BENCHMARK(BM_LookupNodeMap)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+} // namespace
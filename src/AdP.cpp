@@ -1,6 +1,9 @@
 #include "AdP.h"
 #include <iostream>
 #include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <map>
 
 using namespace std;
 
@@ -9,10 +12,135 @@ PDA::PDA(const std::string &initialState, char initialStackSymbol)
 
 void PDA::addTransition(const PDA_Transition &t) {
     transitions.push_back(t);
+    indexDirty = true;
 }
 
 void PDA::addFinalState(const std::string &s) {
     finalStates.insert(s);
+    indexDirty = true;
+}
+
+uint64_t PDA::indexKey(uint32_t state, char input, char pop) {
+    return (static_cast<uint64_t>(state) << 16) |
+           (static_cast<uint64_t>(static_cast<unsigned char>(input)) << 8) |
+           static_cast<unsigned char>(pop);
+}
+
+uint32_t PDA::internState(const std::string &name) {
+    auto it = stateIds.find(name);
+    if (it != stateIds.end()) return it->second;
+    uint32_t id = static_cast<uint32_t>(stateNames.size());
+    stateIds.emplace(name, id);
+    stateNames.push_back(name);
+    return id;
+}
+
+void PDA::buildIndex() {
+    stateNames.clear();
+    stateIds.clear();
+    internState(initialState); // el inicial siempre es el id 0
+
+    // Agrupamos las transiciones por clave; dentro de cada grupo conservan el
+    // orden de inserción, que es el orden en que la DFS las prueba.
+    vector<pair<uint64_t, uint32_t>> porClave(transitions.size());
+    toIds.resize(transitions.size());
+    vector<pair<uint32_t, uint8_t>> formas(transitions.size());
+    for (uint32_t i = 0; i < transitions.size(); ++i) {
+        const PDA_Transition &t = transitions[i];
+        uint32_t from = internState(t.from);
+        porClave[i] = {indexKey(from, t.input, t.pop), i};
+        toIds[i] = internState(t.to);
+        formas[i] = {from, t.input != '\0' ? (t.pop != '\0' ? KIND_SYMBOL_TOP : KIND_SYMBOL)
+                                          : (t.pop != '\0' ? KIND_TOP : KIND_NONE)};
+    }
+    // Así la búsqueda no consulta el índice por formas que el estado no tiene
+    keyKinds.assign(stateNames.size(), 0);
+    for (const auto &f : formas) keyKinds[f.first] |= f.second;
+    sort(porClave.begin(), porClave.end());
+
+    indexOrder.resize(porClave.size());
+    index.clear();
+    for (uint32_t i = 0; i < porClave.size(); ++i) {
+        indexOrder[i] = porClave[i].second;
+        IndexRange &rango = index.try_emplace(porClave[i].first, IndexRange{i, i}).first->second;
+        rango.end = i + 1;
+    }
+
+    finalById.assign(stateNames.size(), 0);
+    for (const string &f : finalStates) {
+        auto it = stateIds.find(f);
+        if (it != stateIds.end()) finalById[it->second] = 1;
+    }
+    indexDirty = false;
+}
+
+template <typename Visit>
+bool PDA::forEachCandidate(uint32_t state, char symbol, char top, Visit visit) const {
+    // A lo más cuatro grupos aplican: entrada (símbolo | ε) x pila (tope | sin pop)
+    IndexRange grupos[4];
+    int cantidad = 0;
+    const uint8_t formas = keyKinds[state];
+    auto agregar = [&](uint8_t forma, char input, char pop) {
+        if (!(formas & forma)) return;
+        auto it = index.find(indexKey(state, input, pop));
+        if (it != index.end()) grupos[cantidad++] = it->second;
+    };
+    if (symbol != '\0') {
+        if (top != '\0') agregar(KIND_SYMBOL_TOP, symbol, top);
+        agregar(KIND_SYMBOL, symbol, '\0');
+    }
+    if (top != '\0') agregar(KIND_TOP, '\0', top);
+    agregar(KIND_NONE, '\0', '\0');
+
+    // Mezcla de los grupos por número de transición para respetar el orden de inserción
+    while (true) {
+        int menor = -1;
+        for (int g = 0; g < cantidad; ++g) {
+            if (grupos[g].begin == grupos[g].end) continue;
+            if (menor < 0 || indexOrder[grupos[g].begin] < indexOrder[grupos[menor].begin]) menor = g;
+        }
+        if (menor < 0) return false;
+        if (visit(indexOrder[grupos[menor].begin++])) return true;
+    }
+}
+
+set<string> PDA::pruneUselessStates() {
+    // Alcanzables hacia adelante desde el inicial y hacia atrás desde los finales
+    map<string, vector<string>> sucesores, predecesores;
+    for (const auto &t : transitions) {
+        sucesores[t.from].push_back(t.to);
+        predecesores[t.to].push_back(t.from);
+    }
+    auto alcanzables = [](const map<string, vector<string>> &vecinos, const set<string> &semillas) {
+        set<string> vistos = semillas;
+        vector<string> pendientes(semillas.begin(), semillas.end());
+        while (!pendientes.empty()) {
+            string actual = std::move(pendientes.back());
+            pendientes.pop_back();
+            auto it = vecinos.find(actual);
+            if (it == vecinos.end()) continue;
+            for (const string &siguiente : it->second) {
+                if (vistos.insert(siguiente).second) pendientes.push_back(siguiente);
+            }
+        }
+        return vistos;
+    };
+    set<string> desdeInicial = alcanzables(sucesores, {initialState});
+    set<string> haciaFinal = alcanzables(predecesores, finalStates);
+
+    set<string> eliminados;
+    for (const auto &t : transitions) {
+        for (const string &estado : {t.from, t.to}) {
+            if (!desdeInicial.count(estado) || !haciaFinal.count(estado)) eliminados.insert(estado);
+        }
+    }
+    transitions.erase(remove_if(transitions.begin(), transitions.end(),
+                                [&](const PDA_Transition &t) {
+                                    return eliminados.count(t.from) || eliminados.count(t.to);
+                                }),
+                      transitions.end());
+    indexDirty = true;
+    return eliminados;
 }
 
 string PDA::stackToString(const stack<char> &s) {
@@ -26,106 +154,274 @@ string PDA::stackToString(const stack<char> &s) {
     return out; // top..bottom
 }
 
+string PDA::stackString(const StackArena &arena, uint32_t stack) {
+    string out;
+    for (uint32_t n = stack; n != EMPTY_STACK; n = arena[n].below) out.push_back(arena[n].symbol);
+    return out; // top..bottom
+}
+
 optional<PDA_Step> PDA::getStepFromPath(const vector<PDA_Step> &path, size_t i) const {
     if (i >= path.size()) return nullopt;
     return path[i];
 }
 
 bool PDA::accepts(const std::string &input, std::vector<PDA_Step> *outPath, int maxSteps) {
-    // Config inicial
+    PDA_SearchOptions options;
+    options.maxSteps = maxSteps;
+    return search(input, options, outPath).accepted;
+}
+
+PDA_SearchResult PDA::search(const std::string &input, const PDA_SearchOptions &options,
+                             std::vector<PDA_Step> *outPath) {
+    if (indexDirty) buildIndex();
+
+    Search busqueda{input, options, {}, {}, {}, NO_LINK, {}, EMPTY_STACK, {}};
+    Outcome resultado;
+    switch (options.strategy) {
+        case PDA_SearchStrategy::BreadthFirst:
+            resultado = breadthFirst(busqueda);
+            break;
+        case PDA_SearchStrategy::IterativeDeepening:
+            // Se repite con un límite mayor mientras alguna rama se haya cortado;
+            // los pasos de todas las pasadas cuentan para maxSteps
+            for (size_t limite = 0;; ++limite) {
+                busqueda.clear();
+                resultado = depthFirst(busqueda, limite);
+                if (resultado != Outcome::CutOff) break;
+            }
+            break;
+        case PDA_SearchStrategy::DepthFirst:
+        default:
+            resultado = depthFirst(busqueda, SIZE_MAX);
+            break;
+    }
+
+    busqueda.result.accepted = resultado == Outcome::Accepted;
+    busqueda.result.limitReached = resultado == Outcome::LimitReached;
+    // Las cadenas de la ruta sólo se construyen si alguien las pidió
+    if (busqueda.result.accepted && outPath) {
+        *outPath = materializePath(busqueda.links, busqueda.acceptedLink, busqueda.arena);
+    }
+    return busqueda.result;
+}
+
+vector<PDA_Step> PDA::materializePath(const vector<PathLink> &links, uint32_t last,
+                                      const StackArena &arena) const {
+    vector<PDA_Step> path;
+    for (uint32_t l = last; l != NO_LINK; l = links[l].parent) {
+        const PathLink &link = links[l];
+        const PDA_Transition &t = transitions[link.transition];
+        PDA_Step step;
+        step.fromState = t.from;
+        step.toState = t.to;
+        step.consumed = t.input;
+        step.popped = t.pop; // el índice sólo aplica un pop si coincide con el tope
+        step.pushed = t.push;
+        step.stackSnapshot = stackString(arena, link.stack);
+        step.inputIndex = link.inputIndex;
+        path.push_back(std::move(step));
+    }
+    reverse(path.begin(), path.end());
+    return path;
+}
+
+PDA::Config PDA::startConfig(Search &search) const {
     Config start;
-    start.state = initialState;
+    start.state = 0; // id de initialState
     start.inputIndex = 0;
-    start.stack = std::stack<char>();
-    start.stack.push(initialStackSymbol);
-
-    vector<PDA_Step> pathSoFar;
-    vector<PDA_Step> resultPath;
-    int stepsRemaining = maxSteps;
+    start.stack = pushSymbol(search, EMPTY_STACK, initialStackSymbol);
+    start.link = NO_LINK;
+    return start;
+}
 
-    bool found = dfs_find(input, start, pathSoFar, resultPath, stepsRemaining);
+uint32_t PDA::pushSymbol(Search &search, uint32_t stack, char symbol) {
+    uint32_t nuevo = static_cast<uint32_t>(search.arena.size());
+    if (search.options.memoize) {
+        // Misma pila = mismo nodo, así la clave de una configuración es exacta
+        uint32_t primero = stack == EMPTY_STACK ? search.roots : search.trie[stack].firstChild;
+        for (uint32_t n = primero; n != EMPTY_STACK; n = search.trie[n].nextSibling) {
+            if (search.arena[n].symbol == symbol) return n; // esta pila ya existía
+        }
+        search.trie.push_back({EMPTY_STACK, primero});
+        (stack == EMPTY_STACK ? search.roots : search.trie[stack].firstChild) = nuevo;
+    }
+    search.arena.push_back({symbol, stack});
+    return nuevo;
+}
 
-    if (found) {
-        if (outPath) *outPath = resultPath;
+bool PDA::alreadySeen(Search &search, const Config &c, uint32_t depth) {
+    if (!search.options.memoize) return false;
+    auto it = search.visited.tryEmplace(ConfigKey{c.state, c.inputIndex, c.stack}, depth);
+    if (it.second) return false;
+    if (*it.first <= depth) {
+        ++search.result.prunedConfigurations;
+        return true;
     }
-    return found;
+    *it.first = depth; // ahora se llega con más presupuesto de profundidad
+    return false;
 }
 
-bool PDA::dfs_find(const std::string &input,
-                   Config current,
-                   vector<PDA_Step> &pathSoFar,
-                   vector<PDA_Step> &resultPath,
-                   int &stepsRemaining) {
-    if (stepsRemaining-- <= 0) return false; // prevenimos loops infinitos
+bool PDA::mayRepeat(uint32_t transition, bool branched) const {
+    // Un ciclo que vuelve a la misma configuración no consume entrada, así que
+    // para cortarlos basta con registrar las que se alcanzan por ε; las que salen
+    // de una bifurcación cubren los caminos que convergen. Las demás (única salida
+    // de su padre, consumiendo) no se registran: a lo sumo se exploran de nuevo.
+    return branched || transitions[transition].input == '\0';
+}
+
+PDA::Outcome PDA::visit(Search &search, const Config &c) const {
+    if (search.result.steps >= search.options.maxSteps) return Outcome::LimitReached; // prevenimos loops infinitos
+    ++search.result.steps;
 
     // Aceptación por estado final (y opcionalmente pila vacía si tu definición la requiere)
-    if ((int)current.inputIndex == (int)input.size() && finalStates.count(current.state)) {
-        // Construimos resultPath = pathSoFar (ya contiene snapshots)
-        resultPath = pathSoFar;
-        return true;
+    if (c.inputIndex == (int)search.input.size() && finalById[c.state]) {
+        search.acceptedLink = c.link;
+        return Outcome::Accepted;
     }
+    return Outcome::Exhausted;
+}
 
-    // Recorremos todas las transiciones posibles desde current.state
-    for (const auto &t : transitions) {
-        if (t.from != current.state) continue;
-
-        // Checamos si el input coincide (o es epsilon)
-        bool inputMatches = false;
-        if (t.input == '\0') {
-            inputMatches = true; // epsilon
-        } else {
-            if (current.inputIndex < (int)input.size() && input[current.inputIndex] == t.input)
-                inputMatches = true;
+void PDA::collectMoves(const Search &search, const Config &c, vector<uint32_t> &out) const {
+    // Sólo las transiciones que aplican a (estado, símbolo actual, tope)
+    char symbol = c.inputIndex < (int)search.input.size() ? search.input[c.inputIndex] : '\0';
+    char top = c.stack == EMPTY_STACK ? '\0' : search.arena[c.stack].symbol;
+    forEachCandidate(c.state, symbol, top, [&](uint32_t i) {
+        out.push_back(i);
+        return false;
+    });
+}
+
+PDA::Config PDA::apply(Search &search, const Config &c, uint32_t i) const {
+    const PDA_Transition &t = transitions[i];
+
+    // El índice ya garantizó que la entrada y el tope coinciden
+    uint32_t newStack = c.stack;
+    if (t.pop != '\0') newStack = search.arena[newStack].below;
+
+    // Push (la cadena push se aplica como: se empuja la cadena de derecha a izquierda
+    // de tal forma que el primer char de push quede más abajo y el último char sea top)
+    for (auto it = t.push.rbegin(); it != t.push.rend(); ++it) {
+        newStack = pushSymbol(search, newStack, *it);
+    }
+
+    // Nueva configuración, con el paso registrado en el rastro
+    Config next;
+    next.state = toIds[i];
+    next.inputIndex = c.inputIndex + ((t.input == '\0') ? 0 : 1);
+    next.stack = newStack;
+    next.link = static_cast<uint32_t>(search.links.size());
+    search.links.push_back({c.link, i, next.inputIndex, newStack});
+    return next;
+}
+
+bool PDA::overMemory(const Search &search, size_t worklistBytes) {
+    size_t usados = search.arena.size() * sizeof(StackNode) +
+                    search.links.size() * sizeof(PathLink) + worklistBytes +
+                    search.trie.size() * sizeof(StackChildren) + search.visited.bytes();
+    return usados > search.options.maxMemoryBytes;
+}
+
+PDA::Outcome PDA::depthFirst(Search &search, size_t depthLimit) const {
+    // Un marco por configuración del camino actual, como lo haría la recursión.
+    // Los movimientos pendientes del marco de arriba son el final de `moves`.
+    struct Frame {
+        Config config;
+        uint32_t firstMove, nextMove; // movimientos del marco: [firstMove, moves.size())
+        uint32_t arenaMark, linkMark; // tamaños antes de crear la configuración
+    };
+    vector<Frame> frames;
+    vector<uint32_t> moves;
+    frames.reserve(64);
+    moves.reserve(256);
+    bool cortado = false;
+
+    // Sin límite la profundidad no importa: una configuración ya vista tiene su
+    // subárbol explorado (o es un ancestro, y volver a ella es un ciclo)
+    const bool conLimite = depthLimit != SIZE_MAX;
+
+    // Visita `c` y, si la búsqueda sigue, la apila con sus movimientos pendientes
+    auto entrar = [&](const Config &c, bool registrar, size_t arenaMark, size_t linkMark) {
+        if (registrar && alreadySeen(search, c, conLimite ? static_cast<uint32_t>(frames.size()) : 0)) {
+            search.links.resize(linkMark);
+            return Outcome::Exhausted;
         }
-        if (!inputMatches) continue;
-
-        // Checamos pop: si se debe desapilar un símbolo (t.pop != '\0')
-        std::stack<char> newStack = current.stack;
-        char popped = '\0';
-        if (t.pop != '\0') {
-            if (newStack.empty()) continue; // no se puede pop
-            if (newStack.top() != t.pop) continue; // tope no coincide
-            popped = newStack.top();
-            newStack.pop();
+        Outcome o = visit(search, c);
+        if (o != Outcome::Exhausted) return o;
+
+        uint32_t primero = static_cast<uint32_t>(moves.size());
+        collectMoves(search, c, moves);
+        if (frames.size() >= depthLimit && moves.size() > primero) {
+            cortado = true; // había a dónde seguir, pero no con este límite
+            moves.resize(primero);
         }
+        frames.push_back({c, primero, primero, static_cast<uint32_t>(arenaMark),
+                          static_cast<uint32_t>(linkMark)});
 
-        // Push (la cadena push se aplica como: se empuja la cadena de derecha a izquierda
-        // de tal forma que el primer char de push quede más abajo y el último char sea top)
-        if (!t.push.empty()) {
-            // empujar en orden: primero char 0 será más abajo -> debemos empujar de derecha a izquierda
-            for (auto it = t.push.rbegin(); it != t.push.rend(); ++it) {
-                newStack.push(*it);
-            }
+        search.result.peakConfigurations = std::max(search.result.peakConfigurations, frames.size());
+        if (frames.size() > search.options.maxConfigurations ||
+            overMemory(search, frames.size() * sizeof(Frame) + moves.size() * sizeof(uint32_t))) {
+            return Outcome::LimitReached;
         }
+        return Outcome::Exhausted;
+    };
 
-        // Preparar la estructura de paso para el registro
-        PDA_Step step;
-        step.fromState = current.state;
-        step.toState = t.to;
-        step.consumed = (t.input == '\0') ? '\0' : t.input;
-        step.popped = popped;
-        step.pushed = t.push;
-        // inputIndex después del paso:
-        step.inputIndex = current.inputIndex + ((t.input == '\0') ? 0 : 1);
-        step.stackSnapshot = stackToString(newStack);
-
-        // Nueva configuración
-        Config next;
-        next.state = t.to;
-        next.inputIndex = step.inputIndex;
-        next.stack = newStack;
-
-        // Agregamos el paso a pathSoFar
-        pathSoFar.push_back(step);
-
-        // DFS recursiva
-        if (dfs_find(input, next, pathSoFar, resultPath, stepsRemaining)) {
-            return true; // si encontró una ruta, propagamos true y dejamos resultPath listo
+    Outcome o = entrar(startConfig(search), true, 0, 0);
+    if (o != Outcome::Exhausted) return o;
+
+    while (!frames.empty()) {
+        Frame &actual = frames.back();
+        if (actual.nextMove == moves.size()) {
+            // backtrack: los pasos que creó esta rama no los referencia nadie más, y
+            // sus nodos de pila tampoco salvo que la memoización los comparta
+            moves.resize(actual.firstMove);
+            if (!search.options.memoize) search.arena.resize(actual.arenaMark);
+            search.links.resize(actual.linkMark);
+            frames.pop_back();
+            continue;
         }
 
-        // backtrack
-        pathSoFar.pop_back();
+        bool ramifica = moves.size() - actual.firstMove > 1;
+        uint32_t t = moves[actual.nextMove++];
+        size_t arenaMark = search.arena.size();
+        size_t linkMark = search.links.size();
+        Config hijo = apply(search, actual.config, t);
+        o = entrar(hijo, mayRepeat(t, ramifica), arenaMark, linkMark);
+        if (o != Outcome::Exhausted) return o;
     }
+    return cortado ? Outcome::CutOff : Outcome::Exhausted;
+}
 
-    return false;
+PDA::Outcome PDA::breadthFirst(Search &search) const {
+    // Por niveles: la primera configuración de aceptación visitada tiene la ruta más corta.
+    // Las pilas de la frontera se comparten, así que el arena no se recorta.
+    deque<Config> cola;
+    cola.push_back(startConfig(search));
+    alreadySeen(search, cola.front(), 0);
+    vector<uint32_t> moves;
+
+    while (!cola.empty()) {
+        Config actual = cola.front();
+        cola.pop_front();
+        Outcome o = visit(search, actual);
+        if (o != Outcome::Exhausted) return o;
+
+        moves.clear();
+        collectMoves(search, actual, moves);
+        for (uint32_t t : moves) {
+            // Cada configuración entra a la cola una sola vez, en su nivel más bajo
+            Config hijo = apply(search, actual, t);
+            if (mayRepeat(t, moves.size() > 1) && alreadySeen(search, hijo, 0)) {
+                search.links.pop_back(); // su paso es el último del rastro
+            } else {
+                cola.push_back(hijo);
+            }
+        }
+
+        search.result.peakConfigurations = std::max(search.result.peakConfigurations, cola.size());
+        if (cola.size() > search.options.maxConfigurations ||
+            overMemory(search, cola.size() * sizeof(Config))) {
+            return Outcome::LimitReached;
+        }
+    }
+    return Outcome::Exhausted;
 }
@@ -5,12 +5,15 @@
 #ifndef ZFLAP_ADP_H
 #define ZFLAP_ADP_H
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <set>
 #include <stack>
 #include <functional>
 #include <optional>
+#include <unordered_map>
 
 // Representa una transición del PDA:
 // (fromState, inputSymbol, popSymbol) -> (toState, pushString)
@@ -35,6 +38,29 @@ struct PDA_Step { // describe un paso de la ruta de aceptación
     int inputIndex;       // índice en la cadena de entrada después del paso (posición siguiente a la consumida)
 };
 
+// Orden en que la búsqueda explora las configuraciones
+enum class PDA_SearchStrategy {
+    DepthFirst,         // primero en profundidad; mismo orden que las transiciones agregadas
+    BreadthFirst,       // por niveles; la ruta encontrada es la más corta
+    IterativeDeepening  // profundidad con límite creciente; ruta más corta con memoria de DFS
+};
+
+struct PDA_SearchOptions {
+    PDA_SearchStrategy strategy = PDA_SearchStrategy::DepthFirst;
+    int maxSteps = 100000;                  // configuraciones visitadas como máximo
+    size_t maxConfigurations = 1000000;     // configuraciones pendientes a la vez en la lista de trabajo
+    size_t maxMemoryBytes = size_t(64) << 20; // pilas + rastro + lista de trabajo + memo
+    bool memoize = true;                    // no volver a explorar configuraciones ya vistas
+};
+
+struct PDA_SearchResult {
+    bool accepted = false;
+    bool limitReached = false; // se agotó algún límite: un rechazo no es definitivo
+    int steps = 0;             // configuraciones visitadas
+    size_t peakConfigurations = 0; // máximo de configuraciones pendientes a la vez
+    size_t prunedConfigurations = 0; // configuraciones repetidas que no se volvieron a explorar
+};
+
 class PDA {
 public:
     PDA(const std::string &initialState, char initialStackSymbol);
@@ -42,11 +68,24 @@ public:
     void addTransition(const PDA_Transition &t);
     void addFinalState(const std::string &s);
 
+    // Elimina las transiciones que tocan estados inútiles: inalcanzables desde el
+    // estado inicial o sin camino a un estado final en el grafo de transiciones
+    // (ignorando la pila, así que nunca se pierde una ruta de aceptación).
+    // Devuelve los nombres de los estados eliminados.
+    std::set<std::string> pruneUselessStates();
+
     // Busca si la cadena es aceptada (non-deterministic DFS).
     // maxSteps evita loops infinitos (por ejemplo con epsilon-cycles).
     // Si acepta, devuelve true y opcionalmente llena `path` con la secuencia de pasos que llevan a la aceptación.
     bool accepts(const std::string &input, std::vector<PDA_Step> *outPath = nullptr, int maxSteps = 100000);
 
+    // Igual que accepts, con la estrategia y los límites de `options`. La búsqueda
+    // es iterativa (lista de trabajo explícita), así que la profundidad no está
+    // limitada por la pila nativa. `outPath` sólo se escribe si la cadena es aceptada.
+    PDA_SearchResult search(const std::string &input,
+                            const PDA_SearchOptions &options = PDA_SearchOptions(),
+                            std::vector<PDA_Step> *outPath = nullptr);
+
     // Si ya obtuviste una ruta (path) por accepts(..., &path), usa esta función
     // para iterar/mostrar paso a paso en la interfaz. Devuelve el PDA_Step en `i` (si existe).
     std::optional<PDA_Step> getStepFromPath(const std::vector<PDA_Step> &path, size_t i) const;
@@ -60,19 +99,190 @@ private:
     std::vector<PDA_Transition> transitions;
     std::set<std::string> finalStates;
 
-    // Estructura de configuración usada por DFS
+    // Índice de transiciones por (estado, entrada, tope), reconstruido la primera
+    // vez que se busca después de modificar las transiciones.
+    // Los estados se identifican por número para no comparar cadenas en la búsqueda.
+    struct IndexRange {
+        uint32_t begin; // rango [begin, end) dentro de indexOrder
+        uint32_t end;
+    };
+    bool indexDirty = true;
+    std::vector<std::string> stateNames;                  // id -> nombre
+    std::unordered_map<std::string, uint32_t> stateIds;   // nombre -> id
+    std::vector<char> finalById;                          // finalById[id] != 0 si es final
+    std::vector<uint32_t> toIds;                          // toIds[i]: id del destino de transitions[i]
+    std::vector<uint32_t> indexOrder;                     // números de transición agrupados por clave
+    std::unordered_map<uint64_t, IndexRange> index;       // clave -> grupo en indexOrder
+    std::vector<uint8_t> keyKinds;                        // por estado: qué formas de clave tiene (KIND_*)
+
+    // Formas de clave: entrada (símbolo | ε) x pila (tope | sin pop)
+    static constexpr uint8_t KIND_SYMBOL_TOP = 1, KIND_SYMBOL = 2, KIND_TOP = 4, KIND_NONE = 8;
+
+    static uint64_t indexKey(uint32_t state, char input, char pop);
+    uint32_t internState(const std::string &name);
+    void buildIndex();
+
+    // Transiciones aplicables en (state, símbolo actual, tope), en el orden en que
+    // se agregaron. `symbol` y `top` valen '\0' cuando no hay símbolo o la pila está vacía.
+    // Se detiene en cuanto `visit` devuelve true.
+    template <typename Visit>
+    bool forEachCandidate(uint32_t state, char symbol, char top, Visit visit) const;
+
+    // Pila persistente: cada nodo guarda un símbolo y el índice del nodo de abajo
+    // dentro de un arena. Una pila es el índice de su tope, así que las
+    // configuraciones hijas comparten la cola de la pila del padre y push/pop
+    // son O(1) sin copiar nada.
+    static constexpr uint32_t EMPTY_STACK = UINT32_MAX;
+    struct StackNode {
+        char symbol;
+        uint32_t below; // nodo de abajo, o EMPTY_STACK
+    };
+    using StackArena = std::vector<StackNode>;
+
+    // Texto de la pila con el tope al inicio, igual que stackToString
+    static std::string stackString(const StackArena &arena, uint32_t stack);
+
+    // Rastro compacto de la búsqueda: cada paso guarda la transición usada y
+    // apunta al paso anterior. Los PDA_Step completos, con su copia de la pila,
+    // sólo se construyen para la ruta de aceptación (ver materializePath).
+    static constexpr uint32_t NO_LINK = UINT32_MAX;
+    struct PathLink {
+        uint32_t parent;     // paso anterior, o NO_LINK si es el primero
+        uint32_t transition; // índice en transitions
+        int inputIndex;      // posición en la entrada después del paso
+        uint32_t stack;      // tope de la pila después del paso
+    };
+
+    // Configuración de la búsqueda
     struct Config {
-        std::string state;
+        uint32_t state; // id del estado
         int inputIndex; // posición en la cadena de entrada (0..n)
-        std::stack<char> stack;
+        uint32_t stack; // nodo tope en el arena, o EMPTY_STACK
+        uint32_t link;  // paso que llevó aquí, o NO_LINK en la configuración inicial
+    };
+
+    // Clave exacta de una configuración para la memoización. Con memoize las
+    // pilas se comparten por contenido (hash-consing): dos pilas iguales son el
+    // mismo nodo, así que comparar el nodo tope equivale a comparar la pila entera.
+    struct ConfigKey {
+        uint32_t state;
+        int inputIndex;
+        uint32_t stack;
+        bool operator==(const ConfigKey &o) const {
+            return state == o.state && inputIndex == o.inputIndex && stack == o.stack;
+        }
+    };
+    struct ConfigKeyTraits {
+        static ConfigKey empty() { return {UINT32_MAX, 0, 0}; }
+        static size_t hash(const ConfigKey &k) {
+            uint64_t h = (static_cast<uint64_t>(k.state) << 32) ^ static_cast<uint32_t>(k.inputIndex);
+            h ^= static_cast<uint64_t>(k.stack) * 0x9E3779B97F4A7C15ull;
+            h *= 0xFF51AFD7ED558CCDull;
+            return static_cast<size_t>(h ^ (h >> 32));
+        }
+    };
+
+    // Tabla hash plana con sondeo lineal, a lo más medio llena como la de
+    // Transition. A diferencia de std::unordered_map no reserva memoria por
+    // entrada, que es lo que domina cuando cada paso de la búsqueda inserta.
+    // Las casillas vacías guardan Traits::empty() como clave.
+    template <typename Key, typename Value, typename Traits>
+    class FlatMap {
+    public:
+        // Valor de `key`; si no estaba se inserta con `value`. El bool indica si se insertó.
+        std::pair<Value *, bool> tryEmplace(const Key &key, const Value &value) {
+            if ((count + 1) * 2 > slots.size()) grow();
+            size_t i = find(key);
+            if (!(slots[i].key == Traits::empty())) return {&slots[i].value, false};
+            slots[i] = {key, value};
+            ++count;
+            return {&slots[i].value, true};
+        }
+        size_t size() const { return count; }
+        size_t bytes() const { return slots.size() * sizeof(Slot); }
+        void clear() {
+            slots.clear();
+            count = 0;
+        }
+
+    private:
+        struct Slot {
+            Key key;
+            Value value;
+        };
+        std::vector<Slot> slots; // tamaño 0 o potencia de dos
+        size_t count = 0;
+
+        size_t find(const Key &key) const {
+            size_t mask = slots.size() - 1;
+            size_t i = Traits::hash(key) & mask;
+            while (!(slots[i].key == Traits::empty()) && !(slots[i].key == key)) i = (i + 1) & mask;
+            return i;
+        }
+        void grow() {
+            std::vector<Slot> old = std::move(slots);
+            slots.assign(std::max<size_t>(256, old.size() * 2), Slot{Traits::empty(), Value()});
+            for (const Slot &slot : old) {
+                if (!(slot.key == Traits::empty())) slots[find(slot.key)] = slot;
+            }
+        }
     };
+    // Con memoize las pilas forman un trie: los nodos apilados sobre un mismo
+    // nodo son hermanos, y apilar primero busca entre ellos
+    struct StackChildren {
+        uint32_t firstChild = EMPTY_STACK;
+        uint32_t nextSibling = EMPTY_STACK;
+    };
+
+    // Estado compartido por las estrategias durante una búsqueda
+    struct Search {
+        const std::string &input;
+        const PDA_SearchOptions &options;
+        StackArena arena;
+        std::vector<PathLink> links;
+        PDA_SearchResult result;
+        uint32_t acceptedLink = NO_LINK;
+        std::vector<StackChildren> trie;                       // paralelo a `arena`
+        uint32_t roots = EMPTY_STACK;                          // nodos sobre la pila vacía
+        FlatMap<ConfigKey, uint32_t, ConfigKeyTraits> visited; // configuración -> menor profundidad
+
+        void clear() {
+            arena.clear();
+            links.clear();
+            trie.clear();
+            roots = EMPTY_STACK;
+            visited.clear();
+        }
+    };
+
+    // Apila `symbol` sobre `stack`; con memoize reutiliza el nodo si ya existe
+    static uint32_t pushSymbol(Search &search, uint32_t stack, char symbol);
+    // Registra la visita de `c` a profundidad `depth`. Devuelve true si ya se
+    // había visto a esa profundidad o menos, y entonces no hay que explorarla.
+    static bool alreadySeen(Search &search, const Config &c, uint32_t depth);
+    // Si vale la pena registrar la configuración a la que lleva la transición
+    bool mayRepeat(uint32_t transition, bool branched) const;
+
+    // Resultado de una pasada en profundidad
+    enum class Outcome { Accepted, Exhausted, CutOff, LimitReached };
+
+    // Cuenta la visita de `c` y decide si acepta. Devuelve LimitReached si se
+    // agotaron los pasos, Accepted si acepta y Exhausted en otro caso.
+    Outcome visit(Search &search, const Config &c) const;
+    // Aplica la transición `t` a `c`: crea los nodos de pila y el paso del rastro
+    Config apply(Search &search, const Config &c, uint32_t t) const;
+    // Agrega a `out` las transiciones aplicables a `c`, en orden de inserción
+    void collectMoves(const Search &search, const Config &c, std::vector<uint32_t> &out) const;
+    // Memoria en uso por las pilas, el rastro y `worklistBytes` de lista de trabajo
+    static bool overMemory(const Search &search, size_t worklistBytes);
+
+    Config startConfig(Search &search) const;
+    Outcome depthFirst(Search &search, size_t depthLimit) const;
+    Outcome breadthFirst(Search &search) const;
 
-    // DFS interna que construye el path (si encuentra aceptación)
-    bool dfs_find(const std::string &input,
-                  Config current,
-                  std::vector<PDA_Step> &pathSoFar,
-                  std::vector<PDA_Step> &resultPath,
-                  int &stepsRemaining);
+    // Reconstruye los PDA_Step de la ruta que termina en `last`
+    std::vector<PDA_Step> materializePath(const std::vector<PathLink> &links, uint32_t last,
+                                          const StackArena &arena) const;
 };
 
 #endif // PDA_H
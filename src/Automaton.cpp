@@ -2,6 +2,7 @@
 // Created by Isai Nuñez on 10/7/2025.
 //
 #include "Automaton.h"
+#include "validacion_cadenas.h"
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -11,7 +12,16 @@ using namespace std;
 Automaton::Automaton(const string &inicial, const set<string> &finales, const Transition &trans)
     : estadoInicial(inicial), estadosFinales(finales), delta(trans) {}
 
+vector<char> Automaton::getAlfabeto() const {
+    vector<char> alfabeto;
+    for (char simbolo : delta.getSymbols()) {
+        if (simbolo != Transition::EPSILON) alfabeto.push_back(simbolo);
+    }
+    return alfabeto;
+}
+
 void Automaton::dfs(const string &estado, string cadena,
+                    const vector<char> &alfabeto,
                     map<pair<string,char>,int> &contador,
                     int maxLongitud, set<string> &aceptadas) {
     if (estadosFinales.count(estado))
@@ -19,13 +29,13 @@ void Automaton::dfs(const string &estado, string cadena,
 
     if ((int)cadena.size() >= maxLongitud) return;
 
-    for (char simbolo = 'a'; simbolo <= 'z'; simbolo++) {
-        vector<string> siguientes = delta.getNextStates(estado, simbolo);
-        for (const auto &sig : siguientes) {
+    for (char simbolo : alfabeto) {
+        for (StateId id : delta.getNextStateIds(estado, simbolo)) {
+            const string &sig = delta.getStateName(id);
             auto clave = make_pair(estado, simbolo);
             contador[clave]++;
             if (contador[clave] <= maxRepeticiones)
-                dfs(sig, cadena + simbolo, contador, maxLongitud, aceptadas);
+                dfs(sig, cadena + simbolo, alfabeto, contador, maxLongitud, aceptadas);
             contador[clave]--;
         }
     }
@@ -34,13 +44,21 @@ void Automaton::dfs(const string &estado, string cadena,
 set<string> Automaton::generarCadenasAceptadas(int maxLongitud) {
     set<string> aceptadas;
     map<pair<string,char>,int> contador;
-    dfs(estadoInicial, "", contador, maxLongitud, aceptadas);
+    dfs(estadoInicial, "", getAlfabeto(), contador, maxLongitud, aceptadas);
     return aceptadas;
 }
 
-bool Automaton::validarCadena(const string &cadena, int maxLongitud) {
-    set<string> aceptadas = generarCadenasAceptadas(maxLongitud);
-    return aceptadas.count(cadena) > 0;
+// Simula la relación de transición sobre la cadena: O(|cadena|) pasos sobre el
+// conjunto de estados activos, sin generar el lenguaje. Las cerraduras épsilon
+// se calculan una vez por autómata, no por cadena.
+bool Automaton::validarCadena(const string &cadena) const {
+    if (!clausura) clausura = make_shared<const EpsilonClosure>(delta);
+    return esAceptada(delta, *clausura, estadoInicial, estadosFinales, cadena);
+}
+
+bool Automaton::validarCadena(const string &cadena, int maxLongitud) const {
+    if ((int)cadena.size() > maxLongitud) return false;
+    return validarCadena(cadena);
 }
 
 // ----------- NUEVA FUNCIÓN ---------------t
@@ -81,11 +99,10 @@ void Automaton::guardarAutomata(const string &ruta,
 
     archivo << "transitions:\n";
     // Para obtener las transiciones, usamos un truco: reescribimos el mapa delta
-    for (char simbolo = 'a'; simbolo <= 'z'; simbolo++) {
+    for (char simbolo : getAlfabeto()) {
         for (const auto &st : estados) {
-            vector<string> destinos = delta.getNextStates(st, simbolo);
-            for (const auto &dest : destinos) {
-                archivo << st << "," << simbolo << "->" << dest << "\n";
+            for (StateId dest : delta.getNextStateIds(st, simbolo)) {
+                archivo << st << "," << simbolo << "->" << delta.getStateName(dest) << "\n";
             }
         }
     }
@@ -4,7 +4,9 @@
 #include <string>
 #include <set>
 #include <map>
+#include <memory>
 #include <vector>
+#include "EpsilonClosure.h"
 #include "Transition.h"
 
 class Automaton {
@@ -13,8 +15,12 @@ private:
     std::string estadoInicial;
     std::set<std::string> estadosFinales;
     int maxRepeticiones = 3;
+    // Cerraduras épsilon de delta, calculadas en la primera validación y
+    // descartadas cuando se pide delta para modificarla
+    mutable std::shared_ptr<const EpsilonClosure> clausura;
 
     void dfs(const std::string &estado, std::string cadena,
+             const std::vector<char> &alfabeto,
              std::map<std::pair<std::string,char>,int> &contador,
              int maxLongitud, std::set<std::string> &aceptadas);
 
@@ -23,9 +29,25 @@ public:
     Automaton(const std::string &inicial, const std::set<std::string> &finales, const Transition &trans);
 
     std::set<std::string> generarCadenasAceptadas(int maxLongitud);
-    bool validarCadena(const std::string &cadena, int maxLongitud);
 
-    Transition& getDelta() { return delta; }
+    // Pertenencia por simulación directa, lineal en la longitud de la cadena.
+    // La primera llamada calcula las cerraduras épsilon; no llamarla desde
+    // varios hilos a la vez sobre el mismo autómata.
+    bool validarCadena(const std::string &cadena) const;
+    // Igual, pero rechaza cadenas más largas que maxLongitud
+    bool validarCadena(const std::string &cadena, int maxLongitud) const;
+
+    // Símbolos usados por alguna transición (sin épsilon), en orden ascendente
+    std::vector<char> getAlfabeto() const;
+
+    // Puede modificar delta, así que descarta las cerraduras en caché
+    Transition& getDelta() {
+        clausura.reset();
+        return delta;
+    }
+    const Transition& getDelta() const { return delta; }
+    const std::string& getEstadoInicial() const { return estadoInicial; }
+    const std::set<std::string>& getEstadosFinales() const { return estadosFinales; }
 
     // Nueva función
     void guardarAutomata(const std::string &ruta,
@@ -11,8 +11,13 @@
 #include <QGraphicsTextItem>
 #include <QMessageBox>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
 #include <QFileDialog>
 #include <QTimer>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentRun>
 #include <vector>
 #include <QTextEdit>
 #include <QSpinBox>
@@ -200,7 +205,7 @@ void MinimapView::paintEvent(QPaintEvent *event)
 // StateItem Implementation
 //================================================================================
 StateItem::StateItem(const QString& name, QGraphicsItem *parent)
-    : QGraphicsEllipseItem(-25, -25, 50, 50, parent), stateName(name), isFinalState(false), isInitialState(false)
+    : QGraphicsEllipseItem(-25, -25, 50, 50, parent), stateName(name), isFinalState(false), isInitialState(false), isPrunedState(false)
 {
     setBrush(Qt::lightGray);
     setFlag(QGraphicsItem::ItemIsSelectable);
@@ -259,6 +264,21 @@ void StateItem::highlight(bool on) {
     }
 }
 
+void StateItem::setPruned(bool pruned) {
+    if (pruned == isPrunedState) return;
+    isPrunedState = pruned;
+    if (pruned) {
+        // Dashed red outline: unreachable from the initial state or unable to reach a final one
+        setPen(QPen(QColor(200, 60, 60), 2, Qt::DashLine));
+        setToolTip("Pruned: this state is unreachable or cannot reach a final state");
+    } else {
+        setPen(QPen()); // default outline
+        setToolTip(QString());
+    }
+}
+
+bool StateItem::isPruned() const { return isPrunedState; }
+
 void StateItem::mousePressEvent(QGraphicsSceneMouseEvent *event) {
     QGraphicsItem::mousePressEvent(event);
     scene()->clearSelection();
@@ -610,16 +630,18 @@ AutomatonEditor::AutomatonEditor(QWidget *parent)
     : QWidget(parent), stateCounter(0), currentTool(SELECT), startTransitionState(nullptr), selectedTransitionItem(nullptr), initialState(nullptr), toolButtonGroup(nullptr),
       saveButton(nullptr), mainLayout(nullptr), contentLayout(nullptr), graphicsView(nullptr), scene(nullptr), toolbarLayout(nullptr), toolsGroup(nullptr),
       addStateButton(nullptr), linkButton(nullptr), setInitialButton(nullptr), toggleFinalButton(nullptr), validateChainButton(nullptr),
-      generatePanelButton(nullptr), validationBox(nullptr), chainInput(nullptr), playButton(nullptr), pauseButton(nullptr),
+      generatePanelButton(nullptr), minimizeButton(nullptr), validationBox(nullptr), chainInput(nullptr), playButton(nullptr), pauseButton(nullptr),
       nextStepButton(nullptr), clearButton(nullptr), instantValidateButton(nullptr), validationStatusLabel(nullptr),
       resetZoomButton(nullptr),
       transitionBox(nullptr), transitionInputSymbolEdit(nullptr), transitionPopSymbolEdit(nullptr), transitionPushStringEdit(nullptr),
       fromStateLabel(nullptr), toStateLabel(nullptr),
       updateTransitionButton(nullptr), generationBox(nullptr), maxLengthSpinBox(nullptr), generateButton(nullptr),
-      resultsTextEdit(nullptr), inputSymbolLabel(nullptr), inputChainLabel(nullptr), maxLengthLabel(nullptr), resultsLabel(nullptr),
+      resultsTextEdit(nullptr), countLengthSpinBox(nullptr), countButton(nullptr), countResultLabel(nullptr),
+      sampleLengthSpinBox(nullptr), sampleCountSpinBox(nullptr), sampleSeedSpinBox(nullptr), sampleButton(nullptr),
+      inputSymbolLabel(nullptr), inputChainLabel(nullptr), maxLengthLabel(nullptr), resultsLabel(nullptr),
       minimapView(nullptr), validationStep(0),
       pda(nullptr), tm(nullptr), currentAutomatonType(MainWindow::FiniteAutomaton), pdaInitialStackSymbol('\0'), tmBlankSymbol('_'),
-      validationDetailsText(nullptr), pdaStackBox(nullptr), pdaStackList(nullptr), pdaInitialStackLabel(nullptr), pdaInitialStackEdit(nullptr), pdaStepIndex(0), tmStepIndex(0)
+      validationDetailsText(nullptr), pdaStackBox(nullptr), pdaStackList(nullptr), pdaInitialStackLabel(nullptr), pdaInitialStackEdit(nullptr), pdaStepIndex(0), pdaSearchInconclusive(false), tmStepIndex(0)
 {
     // ADDED: Initialize new label
     automatonTypeLabel = nullptr;
@@ -713,10 +735,8 @@ void AutomatonEditor::rebuildTransitionHandler()
 
             if (currentAutomatonType == MainWindow::FiniteAutomaton) {
                 // Get the symbols from the label, e.g., "a,b"
-                char symbol = transItem->getSymbol();
-                if (symbol != '\0') { // '\0' represents epsilon for FA
-                    transitionHandler.addTransition(from, symbol, to);
-                }
+                // '\0' is stored as Transition::EPSILON, so ε-moves are kept
+                transitionHandler.addTransition(from, transItem->getSymbol(), to);
             } else if (currentAutomatonType == MainWindow::StackAutomaton) {
                 if (pda) {
                     PDA_Transition pdaTrans;
@@ -748,6 +768,8 @@ void AutomatonEditor::rebuildTransitionHandler()
                 pda->addFinalState(pair.first.toStdString());
             }
         }
+        // The search never needs transitions of states off every accepting path
+        markPrunedStates(pda->pruneUselessStates());
     } else if (currentAutomatonType == MainWindow::TuringMachine && tm) {
         for (const auto& pair : stateItems) {
             if (pair.second->isFinal()) {
@@ -756,10 +778,53 @@ void AutomatonEditor::rebuildTransitionHandler()
         }
     }
 
+    // Epsilon closures are computed once here and reused by every validation step
+    epsilonClosure = EpsilonClosure(transitionHandler);
+
+    // Without an initial state every state would look unreachable, so nothing is marked
+    if (currentAutomatonType == MainWindow::FiniteAutomaton && initialState) {
+        markPrunedStates(trimAutomaton(transitionHandler, initialState->getName().toStdString(),
+                                       getFinalStates()).removedStates);
+    } else if (currentAutomatonType != MainWindow::StackAutomaton || !initialState) {
+        markPrunedStates({});
+    }
+
     updateAutomatonTypeDisplay(); // Update type after rebuilding
     updateMinimap(); // Ensure minimap is up-to-date
 }
 
+// Outlines the states the engines drop, so users can see why generation is slow
+// or why part of the automaton never matters. Only states with transitions are
+// reported; isolated states are left alone.
+void AutomatonEditor::markPrunedStates(const std::set<std::string> &pruned)
+{
+    for (const auto &pair : stateItems) {
+        pair.second->setPruned(pruned.count(pair.first.toStdString()) > 0);
+    }
+}
+
+void AutomatonEditor::addEpsilonClosure(StateItem *state,
+                                        std::set<StateItem*> &seen,
+                                        std::vector<StateItem*> &out) const
+{
+    auto add = [&](StateItem *item) {
+        if (item && seen.insert(item).second) out.push_back(item);
+    };
+
+    StateId id = transitionHandler.getStateId(state->getName().toStdString());
+    if (epsilonClosure.isTrivial() || id == Transition::INVALID_STATE) {
+        add(state);
+        return;
+    }
+
+    StateBitset closure(epsilonClosure.getStateCount());
+    epsilonClosure.addClosure(id, closure);
+    closure.forEach([&](StateId s) {
+        auto it = stateItems.find(QString::fromStdString(transitionHandler.getStateName(s)));
+        if (it != stateItems.end()) add(it->second);
+    });
+}
+
 void AutomatonEditor::keyPressEvent(QKeyEvent *event)
 {
     if (event->key() == Qt::Key_Delete || event->key() == Qt::Key_Backspace) {
@@ -867,7 +932,13 @@ void AutomatonEditor::setupUI() {
     toolbarLayout->addWidget(toggleFinalButton);
     toolbarLayout->addWidget(saveButton);
     toolbarLayout->addWidget(generatePanelButton);
+    // Minimize tool button (finite automata only)
+    minimizeButton = new QPushButton("▣");
+    minimizeButton->setToolTip("Minimize Automaton");
+    minimizeButton->setFixedSize(40, 40);
+
     toolbarLayout->addWidget(validateChainButton);
+    toolbarLayout->addWidget(minimizeButton);
     toolbarLayout->addStretch();
 
     // --- Tool Button Group for mutual exclusivity ---
@@ -884,6 +955,7 @@ void AutomatonEditor::setupUI() {
     connect(toggleFinalButton, &QPushButton::clicked, this, &AutomatonEditor::onToggleFinalState);
     connect(saveButton, &QPushButton::clicked, this, &AutomatonEditor::onSaveAutomatonClicked);
     connect(validateChainButton, &QPushButton::clicked, this, &AutomatonEditor::onValidateToolClicked);
+    connect(minimizeButton, &QPushButton::clicked, this, &AutomatonEditor::onMinimizeClicked);
 
     // --- Sidebar Panels ---
     transitionBox = new QGroupBox("Edit Transition");
@@ -1043,7 +1115,43 @@ void AutomatonEditor::setupUI() {
     generationLayout->addWidget(resultsLabel);
     generationLayout->addWidget(resultsTextEdit);
 
+    // Counting does not list the strings, so it accepts much larger lengths
+    countLengthSpinBox = new QSpinBox();
+    countLengthSpinBox->setRange(0, 5000);
+    countLengthSpinBox->setValue(100);
+    countButton = new QPushButton("Count");
+    countButton->setToolTip("Count accepted strings of each length without listing them");
+    countResultLabel = new QLabel();
+    countResultLabel->setWordWrap(true);
+    countResultLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    generationLayout->addWidget(new QLabel("Count up to length:"));
+    generationLayout->addWidget(countLengthSpinBox);
+    generationLayout->addWidget(countButton);
+    generationLayout->addWidget(countResultLabel);
+
+    // Uniform random accepted strings of a fixed length; the same seed gives the same strings.
+    // The count table grows with the square of the length, so it is capped well below
+    // what StringSampler's memory budget allows for small automata.
+    sampleLengthSpinBox = new QSpinBox();
+    sampleLengthSpinBox->setRange(0, 1000);
+    sampleLengthSpinBox->setValue(10);
+    sampleCountSpinBox = new QSpinBox();
+    sampleCountSpinBox->setRange(1, 1000);
+    sampleCountSpinBox->setValue(10);
+    sampleSeedSpinBox = new QSpinBox();
+    sampleSeedSpinBox->setRange(0, std::numeric_limits<int>::max());
+    sampleSeedSpinBox->setValue(1);
+    sampleButton = new QPushButton("Sample");
+    sampleButton->setToolTip("Draw random accepted strings of the given length, all equally likely");
+    generationLayout->addWidget(new QLabel("Sample length / count / seed:"));
+    generationLayout->addWidget(sampleLengthSpinBox);
+    generationLayout->addWidget(sampleCountSpinBox);
+    generationLayout->addWidget(sampleSeedSpinBox);
+    generationLayout->addWidget(sampleButton);
+
     connect(generateButton, &QPushButton::clicked, this, &AutomatonEditor::onGenerateStringsClicked);
+    connect(countButton, &QPushButton::clicked, this, &AutomatonEditor::onCountStringsClicked);
+    connect(sampleButton, &QPushButton::clicked, this, &AutomatonEditor::onSampleStringsClicked);
 
     // --- Main Layout Assembly ---
     auto *sidebarsLayout = new QVBoxLayout();
@@ -1395,14 +1503,24 @@ void AutomatonEditor::onInstantValidateClicked() {
     if (currentAutomatonType == MainWindow::FiniteAutomaton) {
         std::string startState = initialState->getName().toStdString();
         std::set<std::string> finalStates = getFinalStates();
-        accepted = esAceptada(transitionHandler, startState, finalStates, chain);
+        std::unique_ptr<CompiledDFA> compiled = buildCompiledDFA(transitionHandler, startState, finalStates);
+        // Without a DFA, simulate with the closures rebuildTransitionHandler already computed
+        accepted = compiled ? esAceptada(*compiled, chain)
+                            : esAceptada(transitionHandler, epsilonClosure, startState, finalStates, chain);
     } else if (currentAutomatonType == MainWindow::StackAutomaton) {
         if (!pda) {
             QMessageBox::critical(this, "Error", "PDA object not initialized.");
             return;
         }
-        // The PDA's initial state and stack symbol are set during rebuildTransitionHandler
-        accepted = pda->accepts(chain);
+        // The PDA's initial state and stack symbol are set during rebuildTransitionHandler.
+        // A rejection after the step budget ran out is not a real rejection.
+        PDA_SearchResult result = pda->search(chain);
+        if (!result.accepted && result.limitReached) {
+            validationStatusLabel->setText("Status: Inconclusive, search limit reached (Instant Check)");
+            validationStatusLabel->setStyleSheet("font-weight: bold; color: orange;");
+            return;
+        }
+        accepted = result.accepted;
     } else if (currentAutomatonType == MainWindow::TuringMachine) {
         if (!tm) {
             QMessageBox::critical(this, "Error", "TM object not initialized.");
@@ -1420,6 +1538,71 @@ void AutomatonEditor::onInstantValidateClicked() {
     }
 }
 
+// Accepted strings of a finite automaton up to maxLength, shortest first
+QStringList AutomatonEditor::generateFiniteStrings(const Transition &delta, const std::string &startState,
+                                                   const std::set<std::string> &finalStates,
+                                                   const std::vector<char> &alphabet, int maxLength) {
+    QStringList resultList;
+    // Walk the DFA in shortlex order, only entering branches that can still
+    // reach a final state, so the cost follows the number of results.
+    std::unique_ptr<CompiledDFA> compiled = buildCompiledDFA(delta, startState, finalStates);
+    if (compiled) {
+        // Subtrees below a short prefix are explored on every core, then merged in order
+        for (const std::string &s : generateShortlexParallel(*compiled, alphabet, static_cast<size_t>(maxLength))) {
+            resultList.append(s.empty() ? QString("ε") : QString::fromStdString(s));
+        }
+        return resultList;
+    }
+    // The DFA would be too large: test every candidate on the NFA successor bitsets
+    NFASimulator simulator(trimAutomaton(delta, startState, finalStates).delta, startState, finalStates);
+    auto accepts = [&](const std::string &s) { return esAceptada(simulator, s); };
+    // Check epsilon
+    if (accepts(std::string())) {
+        resultList.append("ε");
+    }
+    // Enumerate strings
+    std::string current;
+    std::function<void(int,int)> genFA = [&](int depth, int target){
+        if (depth == target) {
+            if (accepts(current)) {
+                resultList.append(QString::fromStdString(current));
+            }
+            return;
+        }
+        for (char c : alphabet) {
+            current.push_back(c);
+            genFA(depth+1, target);
+            current.pop_back();
+        }
+    };
+    for (int len = 1; len <= maxLength; ++len) genFA(0, len);
+    return resultList;
+}
+
+// Accepted strings of a PDA up to maxLength, testing every candidate
+QStringList AutomatonEditor::generatePdaStrings(PDA &machine, const std::vector<char> &alphabet, int maxLength) {
+    QStringList resultList;
+    if (machine.accepts("")) {
+        resultList.append("ε");
+    }
+    std::string current;
+    std::function<void(int,int)> gen = [&](int depth, int target){
+        if (depth == target) {
+            if (machine.accepts(current)) {
+                resultList.append(QString::fromStdString(current));
+            }
+            return;
+        }
+        for (char c : alphabet) {
+            current.push_back(c);
+            gen(depth+1, target);
+            current.pop_back();
+        }
+    };
+    for (int len = 1; len <= maxLength; ++len) gen(0, len);
+    return resultList;
+}
+
 // ADDED: New slot to generate accepted strings using the backend function.
 void AutomatonEditor::onGenerateStringsClicked() {
     rebuildTransitionHandler();
@@ -1427,76 +1610,152 @@ void AutomatonEditor::onGenerateStringsClicked() {
         QMessageBox::warning(this, "Error", "An initial state must be set.");
         return;
     }
+    if (currentAutomatonType == MainWindow::TuringMachine) {
+        QMessageBox::information(this, "Feature Not Available", "String generation is not available for Turing Machines.");
+        return;
+    }
+    if (currentAutomatonType == MainWindow::StackAutomaton && !pda) {
+        QMessageBox::critical(this, "Error", "PDA object not initialized.");
+        return;
+    }
 
-    resultsTextEdit->clear();
+    // The enumeration runs on a worker thread over copies of the automaton, so
+    // the window stays responsive; Generate stays disabled until it finishes
+    std::vector<char> alphabet = getAlphabetVector();
+    int maxLength = maxLengthSpinBox->value();
+    std::function<QStringList()> work;
     if (currentAutomatonType == MainWindow::FiniteAutomaton) {
-        std::string startState = initialState->getName().toStdString();
-        std::set<std::string> finalStates = getFinalStates();
-        std::vector<char> alphabet = getAlphabetVector();
-        int maxLength = maxLengthSpinBox->value();
-        QStringList resultList;
-        // Check epsilon
-        if (esAceptada(transitionHandler, startState, finalStates, std::string())) {
-            resultList.append("ε");
-        }
-        // Enumerate strings
-        std::string current;
-        std::function<void(int,int)> genFA = [&](int depth, int target){
-            if (depth == target) {
-                if (esAceptada(transitionHandler, startState, finalStates, current)) {
-                    resultList.append(QString::fromStdString(current));
-                }
-                return;
-            }
-            for (char c : alphabet) {
-                current.push_back(c);
-                genFA(depth+1, target);
-                current.pop_back();
-            }
+        work = [delta = transitionHandler, startState = initialState->getName().toStdString(),
+                finalStates = getFinalStates(), alphabet, maxLength]() {
+            return generateFiniteStrings(delta, startState, finalStates, alphabet, maxLength);
         };
-        for (int len = 1; len <= maxLength; ++len) genFA(0, len);
+    } else {
+        work = [machine = *pda, alphabet, maxLength]() mutable {
+            return generatePdaStrings(machine, alphabet, maxLength);
+        };
+    }
+
+    generateButton->setEnabled(false);
+    resultsTextEdit->setText("Generating...");
+    auto *watcher = new QFutureWatcher<QStringList>(this);
+    connect(watcher, &QFutureWatcher<QStringList>::finished, this, [this, watcher]() {
+        watcher->deleteLater();
+        generateButton->setEnabled(true);
+        QStringList resultList = watcher->result();
         resultsTextEdit->setText(resultList.isEmpty() ? "No strings accepted within the given length." : resultList.join("\n"));
+    });
+    watcher->setFuture(QtConcurrent::run(std::move(work)));
+}
+
+void AutomatonEditor::onCountStringsClicked() {
+    if (currentAutomatonType != MainWindow::FiniteAutomaton) {
+        QMessageBox::information(this, "Feature Not Available", "Counting is only available for finite automata.");
+        return;
+    }
+    rebuildTransitionHandler();
+    if (!initialState) {
+        QMessageBox::warning(this, "Error", "An initial state must be set.");
         return;
     }
 
-    if (currentAutomatonType == MainWindow::StackAutomaton) {
-        if (!pda) {
-            QMessageBox::critical(this, "Error", "PDA object not initialized.");
+    // Counting runs on a worker thread with a copy of the automaton, like sampling
+    struct CountOutcome {
+        std::vector<BigCount> counts;
+        QString error;
+    };
+    auto work = [delta = transitionHandler, initial = initialState->getName().toStdString(),
+                 finals = getFinalStates(), maxLength = static_cast<size_t>(countLengthSpinBox->value())]() {
+        CountOutcome outcome;
+        try {
+            outcome.counts = contarCadenasAceptadas(delta, initial, finals, maxLength);
+        } catch (const std::length_error &e) {
+            outcome.error = QString::fromStdString(e.what());
+        }
+        return outcome;
+    };
+
+    countButton->setEnabled(false);
+    countResultLabel->setText("Counting...");
+    auto *watcher = new QFutureWatcher<CountOutcome>(this);
+    connect(watcher, &QFutureWatcher<CountOutcome>::finished, this, [this, watcher]() {
+        watcher->deleteLater();
+        countButton->setEnabled(true);
+        CountOutcome outcome = watcher->result();
+        if (!outcome.error.isEmpty()) {
+            countResultLabel->clear();
+            QMessageBox::warning(this, "Count", outcome.error);
             return;
         }
-        std::vector<char> alphabet = getAlphabetVector();
-        int maxLength = maxLengthSpinBox->value();
-        QStringList resultList;
-        if (pda->accepts("")) {
-            resultList.append("ε");
-        }
-        std::string current;
-        std::function<void(int,int)> gen = [&](int depth, int target){
-            if (depth == target) {
-                if (pda->accepts(current)) {
-                    resultList.append(QString::fromStdString(current));
-                }
-                return;
-            }
-            for (char c : alphabet) {
-                current.push_back(c);
-                gen(depth+1, target);
-                current.pop_back();
-            }
-        };
-        for (int len = 1; len <= maxLength; ++len) gen(0, len);
-        if (resultList.isEmpty()) {
-            resultsTextEdit->setText("No strings accepted within the given length.");
-        } else {
-            resultsTextEdit->setText(resultList.join("\n"));
+
+        // Total in the label, one line per length in the results box
+        const std::vector<BigCount> &counts = outcome.counts;
+        BigCount total;
+        QStringList perLength;
+        for (size_t length = 0; length < counts.size(); ++length) {
+            total += counts[length];
+            perLength.append(QString("%1: %2").arg(length).arg(QString::fromStdString(counts[length].toString())));
         }
+        countResultLabel->setText(QString("Accepted strings of length ≤ %1: %2")
+                                      .arg(counts.size() - 1)
+                                      .arg(QString::fromStdString(total.toString())));
+        resultsTextEdit->setText(perLength.join("\n"));
+    });
+    watcher->setFuture(QtConcurrent::run(work));
+}
+
+void AutomatonEditor::onSampleStringsClicked() {
+    if (currentAutomatonType != MainWindow::FiniteAutomaton) {
+        QMessageBox::information(this, "Feature Not Available", "Sampling is only available for finite automata.");
         return;
     }
-
-    if (currentAutomatonType == MainWindow::TuringMachine) {
-        QMessageBox::information(this, "Feature Not Available", "String generation is not available for Turing Machines.");
+    rebuildTransitionHandler();
+    if (!initialState) {
+        QMessageBox::warning(this, "Error", "An initial state must be set.");
         return;
     }
+
+    // Counting and sampling run on a worker thread with a copy of the automaton,
+    // so the window stays responsive for long lengths
+    struct SampleOutcome {
+        std::vector<std::string> samples;
+        QString error;
+    };
+    auto work = [delta = transitionHandler, initial = initialState->getName().toStdString(),
+                 finals = getFinalStates(), length = static_cast<size_t>(sampleLengthSpinBox->value()),
+                 count = static_cast<size_t>(sampleCountSpinBox->value()),
+                 seed = static_cast<std::uint64_t>(sampleSeedSpinBox->value())]() {
+        SampleOutcome outcome;
+        try {
+            outcome.samples = muestrearCadenasAceptadas(delta, initial, finals, length, count, seed);
+        } catch (const std::length_error &e) {
+            outcome.error = QString::fromStdString(e.what());
+        }
+        return outcome;
+    };
+
+    sampleButton->setEnabled(false);
+    resultsTextEdit->setText("Sampling...");
+    auto *watcher = new QFutureWatcher<SampleOutcome>(this);
+    connect(watcher, &QFutureWatcher<SampleOutcome>::finished, this, [this, watcher]() {
+        watcher->deleteLater();
+        sampleButton->setEnabled(true);
+        SampleOutcome outcome = watcher->result();
+        if (!outcome.error.isEmpty()) {
+            resultsTextEdit->clear();
+            QMessageBox::warning(this, "Sample", outcome.error);
+            return;
+        }
+        if (outcome.samples.empty()) {
+            resultsTextEdit->setText("No strings accepted with the given length.");
+            return;
+        }
+        QStringList resultList;
+        for (const std::string &s : outcome.samples) {
+            resultList.append(s.empty() ? QString("ε") : QString::fromStdString(s));
+        }
+        resultsTextEdit->setText(resultList.join("\n"));
+    });
+    watcher->setFuture(QtConcurrent::run(work));
 }
 
 void AutomatonEditor::onPdaInitialStackChanged() {
@@ -1514,12 +1773,7 @@ void AutomatonEditor::onPdaInitialStackChanged() {
     pdaInitialStackSymbol = sym;
     rebuildTransitionHandler();
     if (validationBox->isVisible() && !validationChain.isEmpty()) {
-        std::vector<PDA_Step> path;
-        if (pda) {
-            pda->accepts(validationChain.toStdString(), &path);
-        }
-        pdaPath = path;
-        pdaStepIndex = 0;
+        computePdaPath(validationChain.toStdString());
         if (pdaStackList) {
             pdaStackList->clear();
             if (!pdaPath.empty()) {
@@ -1531,6 +1785,99 @@ void AutomatonEditor::onPdaInitialStackChanged() {
     }
 }
 
+// Replaces the finite automaton with its minimal DFA (determinizing it first
+// if needed) and redraws the scene with the new states.
+void AutomatonEditor::onMinimizeClicked() {
+    resetEditorState();
+    if (currentAutomatonType != MainWindow::FiniteAutomaton) {
+        QMessageBox::information(this, "Feature Not Available", "Minimization is only available for finite automata.");
+        return;
+    }
+    if (!initialState) {
+        QMessageBox::warning(this, "Error", "An initial state must be set.");
+        return;
+    }
+
+    rebuildTransitionHandler();
+    std::string startState = initialState->getName().toStdString();
+    std::set<std::string> finalStates = getFinalStates();
+    size_t statesBefore = stateItems.size();
+
+    MinimizationResult result;
+    try {
+        if (CompiledDFA::isDeterministic(transitionHandler)) {
+            result = minimize(DeterministicAutomaton{transitionHandler, startState, finalStates});
+        } else {
+            result = minimize(determinize(transitionHandler, startState, finalStates));
+        }
+    } catch (const std::length_error &e) {
+        QMessageBox::warning(this, "Minimize", QString::fromStdString(e.what()));
+        return;
+    }
+
+    showAutomaton(result.automaton);
+    QMessageBox::information(this, "Minimize",
+                             QString("Minimized from %1 to %2 states.").arg(statesBefore).arg(stateItems.size()));
+}
+
+// Rewrites the scene with the given automaton, placing its states on a circle.
+void AutomatonEditor::showAutomaton(const DeterministicAutomaton &dfa) {
+    clearAutomaton();
+
+    // Initial state first so it lands at the leftmost point of the circle
+    std::vector<std::string> names{dfa.initialState};
+    for (size_t id = 0; id < dfa.delta.getStateCount(); ++id) {
+        if (dfa.delta.getStateName(id) != dfa.initialState) names.push_back(dfa.delta.getStateName(id));
+    }
+
+    const qreal radius = std::max<qreal>(120.0, names.size() * 30.0);
+    for (size_t i = 0; i < names.size(); ++i) {
+        qreal angle = M_PI + 2.0 * M_PI * i / names.size();
+        QString name = QString::fromStdString(names[i]);
+        auto *state = new StateItem(name);
+        state->setPos(radius * cos(angle), radius * sin(angle));
+        state->setIsFinal(dfa.finalStates.count(names[i]) > 0);
+        scene->addItem(state);
+        stateItems[name] = state;
+    }
+    initialState = stateItems[QString::fromStdString(dfa.initialState)];
+    initialState->setIsInitial(true);
+    stateCounter = static_cast<int>(names.size());
+
+    dfa.delta.forEachTransition([&](StateId from, char symbol, StateSpan to) {
+        StateItem *start = stateItems[QString::fromStdString(dfa.delta.getStateName(from))];
+        for (StateId dest : to) {
+            StateItem *end = stateItems[QString::fromStdString(dfa.delta.getStateName(dest))];
+            auto *transition = new TransitionItem(start, end);
+            transition->setSymbol(symbol);
+            scene->addItem(transition);
+            connect(transition, &TransitionItem::itemSelected, this, &AutomatonEditor::onTransitionItemSelected);
+        }
+    });
+
+    rebuildTransitionHandler();
+    graphicsView->centerOn(0, 0);
+}
+
+// Compiles the finite automaton into a dense DFA table, determinizing it first
+// if needed. Returns nullptr when the subset construction exceeds its state
+// cap; callers then fall back to simulating the NFA directly.
+std::unique_ptr<CompiledDFA> AutomatonEditor::buildCompiledDFA(const Transition &delta,
+                                                               const std::string &startState,
+                                                               const std::set<std::string> &finalStates) {
+    // Only states on some accepting path can affect the result
+    const Transition trimmed = trimAutomaton(delta, startState, finalStates).delta;
+    if (CompiledDFA::isDeterministic(trimmed)) {
+        return std::make_unique<CompiledDFA>(trimmed, startState, finalStates);
+    }
+    try {
+        DeterministicAutomaton dfa = determinize(trimmed, startState, finalStates);
+        return std::make_unique<CompiledDFA>(dfa.delta, dfa.initialState, dfa.finalStates);
+    } catch (const std::length_error &) {
+        return nullptr;
+    }
+}
+
 // ADDED: Helper function to get all final state names.
 std::set<std::string> AutomatonEditor::getFinalStates() const {
     std::set<std::string> finalStates;
@@ -1876,6 +2223,28 @@ void AutomatonEditor::resetEditorState() {
     adjustSidebarLayout();
 }
 
+// Finds the trace the PDA animation plays. Breadth-first gives the shortest
+// accepting trace, but it keeps the whole frontier and can run out of budget
+// on inputs the depth-first instant validation accepts. In that case the
+// depth-first search is used instead, so both buttons agree, and the result is
+// only inconclusive if that search runs out of budget too.
+void AutomatonEditor::computePdaPath(const std::string &input)
+{
+    pdaPath.clear();
+    pdaStepIndex = 0;
+    pdaSearchInconclusive = false;
+    if (!pda) return;
+
+    PDA_SearchOptions options;
+    options.strategy = PDA_SearchStrategy::BreadthFirst;
+    PDA_SearchResult result = pda->search(input, options, &pdaPath);
+    if (result.limitReached) {
+        options.strategy = PDA_SearchStrategy::DepthFirst;
+        result = pda->search(input, options, &pdaPath);
+        pdaSearchInconclusive = !result.accepted && result.limitReached;
+    }
+}
+
 void AutomatonEditor::onClearValidation()
 {
     if(validationTimer) validationTimer->stop();
@@ -1886,6 +2255,7 @@ void AutomatonEditor::onClearValidation()
     pdaPath.clear();
     tmPath.clear();
     pdaStepIndex = 0;
+    pdaSearchInconclusive = false;
     tmStepIndex = 0;
     if (pdaStackList) {
         pdaStackList->clear();
@@ -1928,14 +2298,11 @@ void AutomatonEditor::onPlayValidation()
     chainInput->setText(validationChain);
 
     if (currentAutomatonType == MainWindow::StackAutomaton) {
-        std::vector<PDA_Step> path;
         if (!pda) {
             QMessageBox::critical(this, "Error", "PDA object not initialized.");
             return;
         }
-        bool accepted = pda->accepts(validationChain.toStdString(), &path);
-        pdaPath = path;
-        pdaStepIndex = 0;
+        computePdaPath(validationChain.toStdString());
         if (pdaStackList) {
             pdaStackList->clear();
             if (!pdaPath.empty()) {
@@ -1953,8 +2320,11 @@ void AutomatonEditor::onPlayValidation()
     }
 
     validationStep = 0;
-    currentValidationStates.push_back(initialState);
-    initialState->highlight(true);
+    std::set<StateItem*> initialSet;
+    addEpsilonClosure(initialState, initialSet, currentValidationStates);
+    for (StateItem* state : currentValidationStates) {
+        state->highlight(true);
+    }
 
     chainInput->setEnabled(false);
     validationStatusLabel->setText("Status: In progress...");
@@ -1971,6 +2341,12 @@ void AutomatonEditor::onPauseValidation()
 void AutomatonEditor::onNextStepValidation()
 {
     if (currentAutomatonType == MainWindow::StackAutomaton) {
+        if (pdaPath.empty() && pdaSearchInconclusive) {
+            validationTimer->stop();
+            validationStatusLabel->setText("Status: Inconclusive (search limit reached)");
+            validationStatusLabel->setStyleSheet("font-weight: bold; color: orange;");
+            return;
+        }
         if (pdaPath.empty()) {
             validationTimer->stop();
             validationStatusLabel->setText("Status: Rejected (no path)");
@@ -2086,12 +2462,11 @@ void AutomatonEditor::onNextStepValidation()
 
     for (StateItem* currentState : currentValidationStates) {
         std::string from = currentState->getName().toStdString();
-        std::vector<std::string> nextStateNames = transitionHandler.getNextStates(from, symbol);
-        for (const std::string& name : nextStateNames) {
+        for (StateId next : transitionHandler.getNextStateIds(from, symbol)) {
+            const std::string& name = transitionHandler.getStateName(next);
             StateItem* nextStateItem = stateItems[QString::fromStdString(name)];
-            if (nextStateItem && !nextStatesSet.count(nextStateItem)) {
-                nextStatesSet.insert(nextStateItem);
-                nextStatesVec.push_back(nextStateItem);
+            if (nextStateItem) {
+                addEpsilonClosure(nextStateItem, nextStatesSet, nextStatesVec);
             }
         }
     }
@@ -16,11 +16,19 @@
 #include <QMouseEvent>
 #include <QGraphicsSceneMouseEvent>
 #include <QObject>
+#include <QStringList>
 #include "Transition.h"
 #include <set>
 #include <map>
 #include <vector>
+#include <memory>
 #include "validacion_cadenas.h"
+#include "CompiledDFA.h"
+#include "Determinization.h"
+#include "EpsilonClosure.h"
+#include "Minimization.h"
+#include "ParallelGeneration.h"
+#include "Trimming.h"
 #include "MainWindow.h" // Include MainWindow.h for AutomatonType enum
 #include "AdP.h"
 #include "TM.h"
@@ -133,8 +141,11 @@ private slots:
     // ADDED: Slots for new backend functionality
     void onInstantValidateClicked();
     void onGenerateStringsClicked();
+    void onCountStringsClicked();
+    void onSampleStringsClicked();
     void onGenerateToolClicked();
     void onPdaInitialStackChanged();
+    void onMinimizeClicked();
 
     // ADDED: Slots for zoom reset button
     void onBackgroundClicked();
@@ -156,13 +167,27 @@ private:
     void clearAutomaton();
     StateItem* getSelectedState();
     void unhighlightAllStates();
+    void computePdaPath(const std::string &input);
 
     void rebuildTransitionHandler();
+    void markPrunedStates(const std::set<std::string> &pruned);
     void keyPressEvent(QKeyEvent *event) override;
 
     // ADDED: Helper functions to gather automaton data for backend calls
     std::set<std::string> getFinalStates() const;
     std::vector<char> getAlphabetVector() const;
+    void showAutomaton(const DeterministicAutomaton &dfa);
+    // Static so generation can call it off the UI thread on a copy of the transitions
+    static std::unique_ptr<CompiledDFA> buildCompiledDFA(const Transition &delta,
+                                                         const std::string &startState,
+                                                         const std::set<std::string> &finalStates);
+    // Bodies of onGenerateStringsClicked, run on a worker thread over copies of the automaton
+    static QStringList generateFiniteStrings(const Transition &delta, const std::string &startState,
+                                             const std::set<std::string> &finalStates,
+                                             const std::vector<char> &alphabet, int maxLength);
+    static QStringList generatePdaStrings(PDA &machine, const std::vector<char> &alphabet, int maxLength);
+    void addEpsilonClosure(StateItem *state, std::set<StateItem*> &seen,
+                           std::vector<StateItem*> &out) const;
 
     // --- UI Members ---
     QHBoxLayout *mainLayout; // Changed from QVBoxLayout to QHBoxLayout
@@ -179,6 +204,7 @@ private:
     QPushButton *saveButton;
     QPushButton *validateChainButton;
     QPushButton *generatePanelButton;
+    QPushButton *minimizeButton;
     QPushButton *resetZoomButton;
 
     // ADDED: Minimap widgets
@@ -223,6 +249,13 @@ private:
     QSpinBox *maxLengthSpinBox;
     QPushButton *generateButton;
     QTextEdit *resultsTextEdit;
+    QSpinBox *countLengthSpinBox;  // Lengths counted by dynamic programming, far past what can be listed
+    QPushButton *countButton;
+    QLabel *countResultLabel;
+    QSpinBox *sampleLengthSpinBox; // Random accepted strings of one length, reproducible by seed
+    QSpinBox *sampleCountSpinBox;
+    QSpinBox *sampleSeedSpinBox;
+    QPushButton *sampleButton;
 
     // --- Static Labels ---
     QLabel *inputChainLabel;
@@ -232,6 +265,7 @@ private:
 
     // --- Automaton Data & State ---
     Transition transitionHandler; // For Finite Automata
+    EpsilonClosure epsilonClosure; // Closures of transitionHandler, rebuilt with it
     PDA* pda; // For Stack Automata
     TM* tm;   // For Turing Machines
     MainWindow::AutomatonType currentAutomatonType;
@@ -252,6 +286,7 @@ private:
     QString validationChain;
     std::vector<PDA_Step> pdaPath;
     int pdaStepIndex;
+    bool pdaSearchInconclusive; // no path because every search ran out of budget
     std::vector<TM_Step> tmPath;
     int tmStepIndex;
 };
@@ -272,6 +307,8 @@ public:
     void setIsInitial(bool initial);
     bool isInitial() const;
     void highlight(bool on);
+    void setPruned(bool pruned); // Marks a state that no accepting run can use
+    bool isPruned() const;
     void addTransition(TransitionItem *transition);
     void removeTransition(TransitionItem *transition);
 
@@ -286,6 +323,7 @@ private:
     QGraphicsTextItem *label;
     bool isFinalState;
     bool isInitialState;
+    bool isPrunedState;
     // ADDED: Declaration for the final state indicator to fix the memory leak.
     QGraphicsEllipseItem* finalIndicator;
 };
@@ -0,0 +1,117 @@
+/**
+ * @file BigCount.cpp
+ * @brief Implementation of the BigCount class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "BigCount.h"
+#include <algorithm>
+#include <utility>
+
+BigCount::BigCount(std::uint64_t value) {
+    while (value) {
+        limbs.push_back(static_cast<std::uint32_t>(value));
+        value >>= 32;
+    }
+}
+
+BigCount BigCount::fromLimbs(std::vector<std::uint32_t> limbs) {
+    BigCount out;
+    out.limbs = std::move(limbs);
+    out.trim();
+    return out;
+}
+
+void BigCount::trim() {
+    while (!limbs.empty() && limbs.back() == 0) limbs.pop_back();
+}
+
+BigCount &BigCount::operator+=(const BigCount &other) {
+    if (limbs.size() < other.limbs.size()) limbs.resize(other.limbs.size(), 0);
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < limbs.size(); ++i) {
+        if (i >= other.limbs.size() && carry == 0) break;
+        std::uint64_t sum = std::uint64_t(limbs[i]) + other.limb(i) + carry;
+        limbs[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    if (carry) limbs.push_back(static_cast<std::uint32_t>(carry));
+    return *this;
+}
+
+BigCount &BigCount::operator-=(const BigCount &other) {
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < limbs.size(); ++i) {
+        if (i >= other.limbs.size() && borrow == 0) break;
+        std::int64_t diff = std::int64_t(limbs[i]) - other.limb(i) - borrow;
+        borrow = diff < 0 ? 1 : 0;
+        limbs[i] = static_cast<std::uint32_t>(diff + (borrow << 32));
+    }
+    trim();
+    return *this;
+}
+
+std::uint32_t BigCount::divideSmall(std::uint32_t divisor) {
+    std::uint64_t remainder = 0;
+    for (std::size_t i = limbs.size(); i-- > 0;) {
+        std::uint64_t current = (remainder << 32) | limbs[i];
+        limbs[i] = static_cast<std::uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    trim();
+    return static_cast<std::uint32_t>(remainder);
+}
+
+void BigCount::addProduct(const BigCount &other, std::uint32_t factor) {
+    if (factor == 0 || other.isZero()) return;
+    if (limbs.size() < other.limbs.size()) limbs.resize(other.limbs.size(), 0);
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < limbs.size(); ++i) {
+        if (i >= other.limbs.size() && carry == 0) break;
+        std::uint64_t sum = std::uint64_t(limbs[i]) + std::uint64_t(other.limb(i)) * factor + carry;
+        limbs[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    if (carry) limbs.push_back(static_cast<std::uint32_t>(carry));
+}
+
+std::size_t BigCount::bitLength() const {
+    if (limbs.empty()) return 0;
+    std::size_t bits = (limbs.size() - 1) * 32;
+    for (std::uint32_t top = limbs.back(); top; top >>= 1) ++bits;
+    return bits;
+}
+
+bool operator<(const BigCount &a, const BigCount &b) {
+    if (a.limbs.size() != b.limbs.size()) return a.limbs.size() < b.limbs.size();
+    return std::lexicographical_compare(a.limbs.rbegin(), a.limbs.rend(),
+                                        b.limbs.rbegin(), b.limbs.rend());
+}
+
+std::string BigCount::toString() const {
+    if (limbs.empty()) return "0";
+
+    // Peel off base-10^9 digits by repeated division, least significant first
+    std::vector<std::uint32_t> rest = limbs;
+    std::vector<std::uint32_t> chunks;
+    while (!rest.empty()) {
+        std::uint64_t remainder = 0;
+        for (std::size_t i = rest.size(); i-- > 0;) {
+            std::uint64_t current = (remainder << 32) | rest[i];
+            rest[i] = static_cast<std::uint32_t>(current / 1000000000u);
+            remainder = current % 1000000000u;
+        }
+        chunks.push_back(static_cast<std::uint32_t>(remainder));
+        while (!rest.empty() && rest.back() == 0) rest.pop_back();
+    }
+
+    std::string out = std::to_string(chunks.back());
+    for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+        std::string digits = std::to_string(chunks[i]);
+        out.append(9 - digits.size(), '0');
+        out += digits;
+    }
+    return out;
+}
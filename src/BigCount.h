@@ -0,0 +1,74 @@
+/**
+ * @file BigCount.h
+ * @brief Arbitrary-precision unsigned integer for counting strings
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef BIGCOUNT_H
+#define BIGCOUNT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Non-negative integer of unbounded size
+ *
+ * The number of strings of length n accepted by an automaton can reach |Σ|^n,
+ * which overflows any machine word after a few dozen symbols. BigCount
+ * supports only the operations the counting and sampling code needs: sums,
+ * products by and division by a small factor, comparison and decimal output.
+ *
+ * The value is stored as little-endian 32-bit limbs without leading zeros, so
+ * zero is the empty vector.
+ */
+class BigCount {
+public:
+    BigCount() = default;
+
+    /// Create a count from a machine integer.
+    explicit BigCount(std::uint64_t value);
+
+    /// Whether the value is zero.
+    bool isZero() const { return limbs.empty(); }
+
+    /// Add another count.
+    BigCount &operator+=(const BigCount &other);
+
+    /// Subtract a count that is not larger than this one.
+    BigCount &operator-=(const BigCount &other);
+
+    /// Add other * factor.
+    void addProduct(const BigCount &other, std::uint32_t factor);
+
+    /// Divide by a nonzero divisor in place and return the remainder.
+    std::uint32_t divideSmall(std::uint32_t divisor);
+
+    /// Number of significant bits (0 for zero).
+    std::size_t bitLength() const;
+
+    /// Value of the given 32-bit limb (0 past the most significant one).
+    std::uint32_t limb(std::size_t i) const { return i < limbs.size() ? limbs[i] : 0; }
+
+    /// Number of 32-bit limbs in use.
+    std::size_t limbCount() const { return limbs.size(); }
+
+    /// Build a count from little-endian 32-bit limbs (leading zeros allowed).
+    static BigCount fromLimbs(std::vector<std::uint32_t> limbs);
+
+    /// Decimal representation.
+    std::string toString() const;
+
+    friend bool operator<(const BigCount &a, const BigCount &b);
+    friend bool operator==(const BigCount &a, const BigCount &b) { return a.limbs == b.limbs; }
+    friend bool operator!=(const BigCount &a, const BigCount &b) { return !(a == b); }
+
+private:
+    void trim();
+
+    std::vector<std::uint32_t> limbs;
+};
+
+#endif // BIGCOUNT_H
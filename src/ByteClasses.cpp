@@ -0,0 +1,35 @@
+/**
+ * @file ByteClasses.cpp
+ * @brief Implementation of the ByteClasses class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "ByteClasses.h"
+#include <algorithm>
+#include <map>
+#include <utility>
+
+ByteClasses::ByteClasses(const Transition &t) {
+    // Signature of a byte: every (from, to) pair it labels, sorted
+    using Signature = std::vector<std::pair<StateId, StateId>>;
+    std::array<Signature, 256> signatures;
+    t.forEachTransition([&](StateId from, char symbol, StateSpan to) {
+        if (symbol == Transition::EPSILON) return;
+        Signature &sig = signatures[static_cast<unsigned char>(symbol)];
+        for (StateId dest : to) sig.emplace_back(from, dest);
+    });
+
+    // Class 0 is the empty signature: bytes that never move the automaton
+    representatives.push_back(0);
+    std::map<Signature, std::uint8_t> classes;
+    for (int b = 0; b < 256; ++b) {
+        Signature &sig = signatures[b];
+        if (sig.empty()) continue;
+        std::sort(sig.begin(), sig.end());
+        auto inserted = classes.emplace(std::move(sig), static_cast<std::uint8_t>(representatives.size()));
+        if (inserted.second) representatives.push_back(static_cast<unsigned char>(b));
+        byteClass[b] = inserted.first->second;
+    }
+}
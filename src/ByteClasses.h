@@ -0,0 +1,51 @@
+/**
+ * @file ByteClasses.h
+ * @brief Alphabet equivalence classes for compact transition tables
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef BYTECLASSES_H
+#define BYTECLASSES_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Transition.h"
+
+/**
+ * @brief Partition of the 256 input bytes into symbols that behave the same
+ *
+ * Two bytes share a class when every state has exactly the same destination
+ * set on both of them, so a table indexed by class instead of by byte needs one
+ * column per distinct behaviour rather than one per symbol. Class 0 always
+ * groups the bytes without any transition (including the epsilon symbol), and
+ * the remaining classes are numbered by their smallest byte.
+ */
+class ByteClasses {
+public:
+    /**
+     * @brief Compute the classes of an automaton's input bytes
+     * @param t The transition function; epsilon transitions are ignored
+     */
+    explicit ByteClasses(const Transition &t);
+
+    /// Class of an input byte.
+    std::uint8_t classOf(unsigned char byte) const { return byteClass[byte]; }
+
+    /// The full byte -> class map.
+    const std::array<std::uint8_t, 256> &getMap() const { return byteClass; }
+
+    /// Number of classes, including class 0.
+    std::uint32_t getClassCount() const { return static_cast<std::uint32_t>(representatives.size()); }
+
+    /// Smallest byte of a class.
+    unsigned char getRepresentative(std::uint32_t cls) const { return representatives[cls]; }
+
+private:
+    std::array<std::uint8_t, 256> byteClass{};
+    std::vector<unsigned char> representatives;
+};
+
+#endif // BYTECLASSES_H
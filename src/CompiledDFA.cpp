@@ -0,0 +1,95 @@
+/**
+ * @file CompiledDFA.cpp
+ * @brief Implementation of the CompiledDFA class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "CompiledDFA.h"
+#include "ByteClasses.h"
+#include "ShuffleDFA.h"
+#include <stdexcept>
+
+bool CompiledDFA::isDeterministic(const Transition &t) {
+    bool deterministic = true;
+    t.forEachTransition([&](StateId, char symbol, StateSpan to) {
+        if (symbol == '\0' || to.size() > 1) deterministic = false;
+    });
+    return deterministic;
+}
+
+CompiledDFA::CompiledDFA(const Transition &t,
+                         const std::string &initialState,
+                         const std::set<std::string> &finalStates) {
+    // Reject anything the table cannot represent before allocating it
+    t.forEachTransition([&](StateId from, char symbol, StateSpan to) {
+        if (symbol == '\0') {
+            throw std::invalid_argument("CompiledDFA: state '" + t.getStateName(from) +
+                                        "' has an epsilon transition");
+        }
+        if (to.size() > 1) {
+            throw std::invalid_argument("CompiledDFA: state '" + t.getStateName(from) +
+                                        "' has " + std::to_string(to.size()) +
+                                        " transitions on '" + std::string(1, symbol) + "'");
+        }
+    });
+
+    // One column per class of interchangeable symbols; unused bytes share column 0
+    const ByteClasses classes(t);
+    byteClass = classes.getMap();
+    classCount = classes.getClassCount();
+
+    // Row 0 is the dead state and Transition id i lives in row i + 1. An initial
+    // state without transitions is not interned, so it gets a row of its own.
+    stateCount = static_cast<std::uint32_t>(t.getStateCount()) + 1;
+    StateId initialId = t.getStateId(initialState);
+    if (initialId == Transition::INVALID_STATE) {
+        initial = stateCount++;
+    } else {
+        initial = initialId + 1;
+    }
+
+    table.assign(static_cast<std::size_t>(stateCount) * classCount, DEAD_STATE);
+    t.forEachTransition([&](StateId from, char symbol, StateSpan to) {
+        std::size_t row = static_cast<std::size_t>(from + 1) * classCount;
+        table[row + byteClass[static_cast<unsigned char>(symbol)]] = to.front() + 1;
+    });
+
+    acceptBits.assign((stateCount + 63) / 64, 0);
+    for (const std::string &name : finalStates) {
+        std::uint32_t row;
+        if (name == initialState) {
+            row = initial;
+        } else {
+            StateId id = t.getStateId(name);
+            if (id == Transition::INVALID_STATE) continue; // unreachable final state
+            row = id + 1;
+        }
+        acceptBits[row >> 6] |= std::uint64_t(1) << (row & 63);
+    }
+
+    if (ShuffleDFA::fits(*this)) shuffle = std::make_shared<const ShuffleDFA>(*this);
+}
+
+bool CompiledDFA::accepts(const std::string &input) const {
+    return accepts(input.data(), input.size());
+}
+
+bool CompiledDFA::accepts(const char *data, std::size_t length) const {
+    return isAccepting(run(initial, data, length));
+}
+
+std::uint32_t CompiledDFA::run(std::uint32_t state, const char *data, std::size_t length) const {
+    if (shuffle) return shuffle->run(state, data, length);
+    return runTable(state, data, length);
+}
+
+std::uint32_t CompiledDFA::runTable(std::uint32_t state, const char *data, std::size_t length) const {
+    const std::uint32_t *rows = table.data();
+    for (std::size_t i = 0; i < length; ++i) {
+        state = rows[static_cast<std::size_t>(state) * classCount +
+                     byteClass[static_cast<unsigned char>(data[i])]];
+    }
+    return state;
+}
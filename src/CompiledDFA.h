@@ -0,0 +1,128 @@
+/**
+ * @file CompiledDFA.h
+ * @brief Dense table-driven execution engine for deterministic automata
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef COMPILEDDFA_H
+#define COMPILEDDFA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include "Transition.h"
+
+class ShuffleDFA;
+
+/**
+ * @brief Flat transition table compiled from a deterministic Transition
+ *
+ * Every input byte is first mapped to a byte class (see ByteClasses), and the
+ * next state is read from a row-major table indexed by [state][byteClass].
+ * Symbols that lead to the same state everywhere share a column. Missing transitions go
+ * to an explicit dead state, so membership is exactly one table lookup per input
+ * byte with no hashing, no allocation and no string comparisons.
+ *
+ * Row 0 is always the dead state, and byte class 0 always groups the bytes that
+ * have no transition anywhere in the automaton.
+ *
+ * Automata with at most ShuffleDFA::MAX_STATES rows also get a ShuffleDFA,
+ * and run() hands the input to it instead of walking the table.
+ *
+ * The compiled form is immutable and can be shared by several threads.
+ */
+class CompiledDFA {
+public:
+    static constexpr std::uint32_t DEAD_STATE = 0; ///< Sink state reached on missing transitions
+
+    /**
+     * @brief Compile a deterministic automaton
+     * @param t The transition function. Every (state, symbol) pair must have at most
+     *          one destination and there must be no epsilon ('\0') transitions.
+     * @param initialState The initial state (it may have no transitions at all)
+     * @param finalStates The set of accepting states
+     * @throws std::invalid_argument If the automaton is not deterministic
+     */
+    CompiledDFA(const Transition &t,
+                const std::string &initialState,
+                const std::set<std::string> &finalStates);
+
+    /**
+     * @brief Check whether a Transition can be compiled by this class
+     * @return true if no (state, symbol) pair has more than one destination and
+     *         there are no epsilon transitions
+     */
+    static bool isDeterministic(const Transition &t);
+
+    /**
+     * @brief Decide membership of a string
+     * @param input The string to check
+     * @return true if the automaton accepts the string
+     */
+    bool accepts(const std::string &input) const;
+
+    /**
+     * @brief Decide membership of a raw byte range
+     */
+    bool accepts(const char *data, std::size_t length) const;
+
+    /**
+     * @brief Follow a whole byte range from the given state
+     *
+     * Uses the shuffle kernel when the automaton is small enough for it, and
+     * the table walk otherwise.
+     * @return The row reached after the last byte
+     */
+    std::uint32_t run(std::uint32_t state, const char *data, std::size_t length) const;
+
+    /**
+     * @brief Follow a whole byte range with the plain table walk
+     * @return The row reached after the last byte, same as run()
+     */
+    std::uint32_t runTable(std::uint32_t state, const char *data, std::size_t length) const;
+
+    /// The shuffle kernel used by run(), or nullptr if the automaton has too many rows.
+    const ShuffleDFA *getShuffleDFA() const { return shuffle.get(); }
+
+    /// Row index of the initial state.
+    std::uint32_t getInitialState() const { return initial; }
+
+    /// Follow one input byte from the given state.
+    std::uint32_t next(std::uint32_t state, unsigned char byte) const {
+        return table[static_cast<std::size_t>(state) * classCount + byteClass[byte]];
+    }
+
+    /// Whether the given row is an accepting state.
+    bool isAccepting(std::uint32_t state) const {
+        return (acceptBits[state >> 6] >> (state & 63)) & 1u;
+    }
+
+    /// Number of rows in the table, including the dead state.
+    std::uint32_t getStateCount() const { return stateCount; }
+
+    /// Number of columns in the table.
+    std::uint32_t getClassCount() const { return classCount; }
+
+    /// Byte class of an input byte.
+    std::uint8_t getByteClass(unsigned char byte) const { return byteClass[byte]; }
+
+    /// Size of the transition table in bytes.
+    std::size_t getTableBytes() const { return table.size() * sizeof(std::uint32_t); }
+
+private:
+    std::array<std::uint8_t, 256> byteClass{}; ///< Input byte -> column of the table
+    std::uint32_t classCount = 1;              ///< Number of columns (byte classes)
+    std::uint32_t stateCount = 1;              ///< Number of rows (states)
+    std::uint32_t initial = DEAD_STATE;        ///< Row of the initial state
+    std::vector<std::uint32_t> table;          ///< Row-major [state][byteClass] next-state table
+    std::vector<std::uint64_t> acceptBits;     ///< Accepting states as a bitmap over rows
+    std::shared_ptr<const ShuffleDFA> shuffle; ///< Shuffle kernel for small automata, shared by copies
+};
+
+#endif // COMPILEDDFA_H
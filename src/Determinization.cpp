@@ -0,0 +1,144 @@
+/**
+ * @file Determinization.cpp
+ * @brief Implementation of the subset construction
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "Determinization.h"
+#include "ByteClasses.h"
+#include "EpsilonClosure.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Subset = std::vector<StateId>; // sorted, without duplicates
+
+struct SubsetHash {
+    size_t operator()(const Subset &s) const {
+        // FNV-1a over the ids; subsets are short and already canonical
+        std::uint64_t h = 1469598103934665603ull;
+        for (StateId id : s) {
+            h ^= id;
+            h *= 1099511628211ull;
+        }
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+};
+
+std::string subsetName(const Transition &t, const Subset &subset) {
+    std::vector<std::string> names;
+    names.reserve(subset.size());
+    for (StateId id : subset) names.push_back(t.getStateName(id));
+    std::sort(names.begin(), names.end());
+
+    std::string out = "{";
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (i) out += ",";
+        out += names[i];
+    }
+    out += "}";
+    return out;
+}
+
+} // namespace
+
+DeterministicAutomaton determinize(const Transition &t,
+                                   const std::string &initialState,
+                                   const std::set<std::string> &finalStates,
+                                   std::size_t maxStates) {
+    DeterministicAutomaton dfa;
+
+    // Accepting NFA states as a flag per id
+    std::vector<char> isFinal(t.getStateCount(), 0);
+    for (const std::string &name : finalStates) {
+        StateId id = t.getStateId(name);
+        if (id != Transition::INVALID_STATE) isFinal[id] = 1;
+    }
+
+    StateId start = t.getStateId(initialState);
+    if (start == Transition::INVALID_STATE) {
+        // No transitions leave the initial state: the DFA is that state alone
+        dfa.initialState = "{" + initialState + "}";
+        if (finalStates.count(initialState)) dfa.finalStates.insert(dfa.initialState);
+        return dfa;
+    }
+
+    // Symbols of one class have the same successors everywhere: compute them once
+    // per class and label the DFA transition with every member
+    const ByteClasses classes(t);
+    std::vector<std::vector<char>> members(classes.getClassCount());
+    for (char c : t.getSymbols()) {
+        std::uint8_t cls = classes.classOf(static_cast<unsigned char>(c));
+        if (cls != 0) members[cls].push_back(c); // epsilon moves are not input symbols
+    }
+
+    // Every subset is epsilon-closed before it is interned
+    const EpsilonClosure closure(t);
+    StateBitset closed(t.getStateCount());
+    auto close = [&](Subset &subset) {
+        if (closure.isTrivial()) return;
+        closed.clear();
+        for (StateId s : subset) closure.addClosure(s, closed);
+        subset.clear();
+        closed.forEach([&](std::uint32_t s) { subset.push_back(s); }); // ascending
+    };
+
+    // Hash-consed subsets: subset -> DFA state id (in dfa.delta)
+    std::unordered_map<Subset, StateId, SubsetHash> ids;
+    std::vector<std::pair<const Subset *, StateId>> pending;
+
+    auto intern = [&](Subset &&subset) -> StateId {
+        auto it = ids.find(subset);
+        if (it != ids.end()) return it->second;
+        if (ids.size() >= maxStates) {
+            throw std::length_error("determinize: subset construction exceeded the limit of " +
+                                    std::to_string(maxStates) + " DFA states");
+        }
+        std::string name = subsetName(t, subset);
+        if (dfa.delta.getStateId(name) != Transition::INVALID_STATE) {
+            // State names containing ',' or braces can spell another subset
+            name += "#" + std::to_string(ids.size());
+        }
+        StateId id = dfa.delta.internState(name);
+        bool accepting = std::any_of(subset.begin(), subset.end(),
+                                     [&](StateId s) { return isFinal[s]; });
+        if (accepting) dfa.finalStates.insert(dfa.delta.getStateName(id));
+        auto inserted = ids.emplace(std::move(subset), id).first;
+        pending.emplace_back(&inserted->first, id); // keys are stable across rehashing
+        return id;
+    };
+
+    Subset initial{start};
+    close(initial);
+    dfa.initialState = subsetName(t, initial);
+    intern(std::move(initial));
+
+    Subset next;
+    while (!pending.empty()) {
+        const Subset &current = *pending.back().first;
+        StateId from = pending.back().second;
+        pending.pop_back();
+
+        for (std::uint32_t cls = 1; cls < members.size(); ++cls) {
+            next.clear();
+            for (StateId s : current) {
+                StateSpan dest = t.getNextStates(s, members[cls].front());
+                next.insert(next.end(), dest.begin(), dest.end());
+            }
+            if (next.empty()) continue; // dead state stays implicit
+
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+            close(next);
+            StateId to = intern(Subset(next));
+            for (char symbol : members[cls]) dfa.delta.addTransition(from, symbol, to);
+        }
+    }
+
+    return dfa;
+}
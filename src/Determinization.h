@@ -0,0 +1,55 @@
+/**
+ * @file Determinization.h
+ * @brief Subset construction turning an NFA into an equivalent DFA
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef DETERMINIZATION_H
+#define DETERMINIZATION_H
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include "Transition.h"
+
+/**
+ * @brief A finite automaton whose transition function is deterministic
+ *
+ * Every (state, symbol) pair of delta has at most one destination, so the
+ * automaton can be fed directly to CompiledDFA. Missing transitions mean
+ * rejection (the dead state is left implicit).
+ */
+struct DeterministicAutomaton {
+    Transition delta;                  ///< Deterministic transition function
+    std::string initialState;          ///< Initial state
+    std::set<std::string> finalStates; ///< Accepting states
+};
+
+/// Default cap on the number of DFA states produced by determinize().
+constexpr std::size_t DEFAULT_MAX_DFA_STATES = 100000;
+
+/**
+ * @brief Determinize an automaton with the subset construction
+ *
+ * Each DFA state stands for the set of NFA states reachable on the same input.
+ * Subsets are interned as sorted arrays of state ids in a hash table, so every
+ * distinct subset is materialized exactly once. DFA states are named after
+ * their subset, e.g. "{q0,q2}", and only non-empty subsets are created.
+ * Epsilon transitions are eliminated: every subset is epsilon-closed, and the
+ * resulting DFA has none.
+ *
+ * @param t Transition function of the (possibly nondeterministic) automaton
+ * @param initialState Initial state of the automaton
+ * @param finalStates Accepting states of the automaton
+ * @param maxStates Maximum number of DFA states to create
+ * @return The equivalent deterministic automaton
+ * @throws std::length_error If the construction needs more than maxStates states
+ */
+DeterministicAutomaton determinize(const Transition &t,
+                                   const std::string &initialState,
+                                   const std::set<std::string> &finalStates,
+                                   std::size_t maxStates = DEFAULT_MAX_DFA_STATES);
+
+#endif // DETERMINIZATION_H
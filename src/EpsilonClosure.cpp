@@ -0,0 +1,130 @@
+/**
+ * @file EpsilonClosure.cpp
+ * @brief Implementation of the EpsilonClosure class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "EpsilonClosure.h"
+#include <algorithm>
+
+namespace {
+constexpr std::uint32_t UNVISITED = 0xFFFFFFFFu;
+}
+
+EpsilonClosure::EpsilonClosure(const Transition &t)
+    : EpsilonClosure(t, t.getStateCount()) {}
+
+EpsilonClosure::EpsilonClosure(const Transition &t, std::size_t stateCount)
+    : stateCount(stateCount) {
+    if (!t.hasEpsilonTransitions()) return;
+
+    const std::size_t interned = t.getStateCount();
+    auto epsilonSuccessors = [&](std::uint32_t v) -> StateSpan {
+        return v < interned ? t.getNextStates(v, Transition::EPSILON) : StateSpan{};
+    };
+
+    // Iterative Tarjan: components are completed in reverse topological order,
+    // so the closures of every successor component are final when needed.
+    componentOf.assign(stateCount, UNVISITED);
+    std::vector<std::uint32_t> index(stateCount, UNVISITED);
+    std::vector<std::uint32_t> low(stateCount, 0);
+    std::vector<char> onStack(stateCount, 0);
+    std::vector<std::uint32_t> sccStack;
+    std::vector<std::uint32_t> members;
+    struct Frame {
+        std::uint32_t state;
+        std::uint32_t nextEdge;
+    };
+    std::vector<Frame> callStack;
+    std::uint32_t counter = 0;
+
+    for (std::uint32_t root = 0; root < stateCount; ++root) {
+        if (index[root] != UNVISITED) continue;
+
+        index[root] = low[root] = counter++;
+        sccStack.push_back(root);
+        onStack[root] = 1;
+        callStack.push_back({root, 0});
+
+        while (!callStack.empty()) {
+            std::uint32_t v = callStack.back().state;
+            StateSpan succ = epsilonSuccessors(v);
+
+            if (callStack.back().nextEdge < succ.size()) {
+                std::uint32_t w = succ[callStack.back().nextEdge++];
+                if (index[w] == UNVISITED) {
+                    index[w] = low[w] = counter++;
+                    sccStack.push_back(w);
+                    onStack[w] = 1;
+                    callStack.push_back({w, 0});
+                } else if (onStack[w]) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                std::uint32_t parent = callStack.back().state;
+                low[parent] = std::min(low[parent], low[v]);
+            }
+            if (low[v] != index[v]) continue;
+
+            // v is the root of a component: pop its members
+            std::uint32_t component = static_cast<std::uint32_t>(closures.size());
+            members.clear();
+            std::uint32_t w;
+            do {
+                w = sccStack.back();
+                sccStack.pop_back();
+                onStack[w] = 0;
+                componentOf[w] = component;
+                members.push_back(w);
+            } while (w != v);
+
+            // A lone state without epsilon moves is its own closure; store nothing
+            if (members.size() == 1 && epsilonSuccessors(v).empty()) {
+                closures.emplace_back();
+                continue;
+            }
+
+            StateBitset closure(stateCount);
+            for (std::uint32_t m : members) {
+                closure.set(m);
+                for (StateId x : epsilonSuccessors(m)) {
+                    std::uint32_t c = componentOf[x];
+                    if (c == component) continue;
+                    if (closures[c].size() == 0) {
+                        closure.set(x);
+                    } else {
+                        closure.orWith(closures[c]);
+                    }
+                }
+            }
+            closures.push_back(std::move(closure));
+        }
+    }
+}
+
+void EpsilonClosure::addClosure(StateId state, StateBitset &out) const {
+    addClosure(state, out.data());
+}
+
+void EpsilonClosure::addClosure(StateId state, std::uint64_t *row) const {
+    if (!isTrivial()) {
+        const StateBitset &closure = closures[componentOf[state]];
+        if (closure.size() != 0) {
+            const std::uint64_t *words = closure.data();
+            for (std::size_t i = 0; i < closure.wordCount(); ++i) row[i] |= words[i];
+            return;
+        }
+    }
+    row[state >> 6] |= std::uint64_t(1) << (state & 63);
+}
+
+void EpsilonClosure::expand(const StateBitset &states, StateBitset &out) const {
+    out.clear();
+    states.forEach([&](std::uint32_t state) { addClosure(state, out); });
+}
@@ -0,0 +1,75 @@
+/**
+ * @file EpsilonClosure.h
+ * @brief Precomputed epsilon closures of an automaton
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef EPSILONCLOSURE_H
+#define EPSILONCLOSURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "StateBitset.h"
+#include "Transition.h"
+
+/**
+ * @brief Epsilon closure of every state, computed once per automaton
+ *
+ * The epsilon graph is condensed into strongly connected components (states on
+ * an epsilon cycle share one closure). Components are closed in reverse
+ * topological order, so each closure is the union of its own members and the
+ * already-finished closures of its successors. The result is one StateBitset per
+ * component, and expanding a state set is a word-wise OR per member.
+ *
+ * Automata without epsilon transitions take a trivial path with no storage:
+ * every closure is the state itself.
+ */
+class EpsilonClosure {
+public:
+    /// Trivial closure over an empty automaton.
+    EpsilonClosure() = default;
+
+    /**
+     * @brief Compute the closures of every state of an automaton
+     * @param t The transition function; Transition::EPSILON marks epsilon moves
+     * @param stateCount Size of the state sets to produce. It must be at least
+     *        t.getStateCount(); extra ids have no epsilon moves.
+     */
+    EpsilonClosure(const Transition &t, std::size_t stateCount);
+
+    /// Same as EpsilonClosure(t, t.getStateCount()).
+    explicit EpsilonClosure(const Transition &t);
+
+    /// Whether the automaton has no epsilon transitions (closures are singletons).
+    bool isTrivial() const { return componentOf.empty(); }
+
+    /// Size of the state sets this closure works with.
+    std::size_t getStateCount() const { return stateCount; }
+
+    /**
+     * @brief Union of the closures of every state in a set
+     * @param states Input set
+     * @param out Receives the closure of the set (overwritten, must not alias states)
+     */
+    void expand(const StateBitset &states, StateBitset &out) const;
+
+    /**
+     * @brief Add the closure of one state to a set
+     */
+    void addClosure(StateId state, StateBitset &out) const;
+
+    /**
+     * @brief Add the closure of one state to a raw row of words
+     */
+    void addClosure(StateId state, std::uint64_t *row) const;
+
+private:
+    std::size_t stateCount = 0;
+    std::vector<std::uint32_t> componentOf; ///< State -> SCC index; empty if trivial
+    std::vector<StateBitset> closures;      ///< Closure of every SCC
+};
+
+#endif // EPSILONCLOSURE_H
@@ -0,0 +1,69 @@
+/**
+ * @file LanguageCounter.cpp
+ * @brief Implementation of the LanguageCounter class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "LanguageCounter.h"
+#include <utility>
+
+LanguageCounter::LanguageCounter(const CompiledDFA &dfa)
+    : stateCount(dfa.getStateCount()), initial(dfa.getInitialState()) {
+    // Bytes per class; class 0 only ever leads to the dead state
+    std::vector<std::uint32_t> classSize(dfa.getClassCount(), 0);
+    std::vector<unsigned char> representative(dfa.getClassCount(), 0);
+    for (int b = 255; b >= 0; --b) {
+        std::uint8_t cls = dfa.getByteClass(static_cast<unsigned char>(b));
+        ++classSize[cls];
+        representative[cls] = static_cast<unsigned char>(b);
+    }
+
+    // Merge the classes of a row that share a target; the dead state counts nothing
+    std::vector<std::uint32_t> slot(stateCount, 0xFFFFFFFFu);
+    edgeStart.reserve(stateCount + 1);
+    accepting.resize(stateCount);
+    for (std::uint32_t p = 0; p < stateCount; ++p) {
+        edgeStart.push_back(static_cast<std::uint32_t>(edges.size()));
+        accepting[p] = dfa.isAccepting(p) ? 1 : 0;
+        for (std::uint32_t cls = 1; cls < dfa.getClassCount(); ++cls) {
+            std::uint32_t q = dfa.next(p, representative[cls]);
+            if (q == CompiledDFA::DEAD_STATE) continue;
+            if (slot[q] != 0xFFFFFFFFu && slot[q] >= edgeStart.back()) {
+                edges[slot[q]].weight += classSize[cls];
+            } else {
+                slot[q] = static_cast<std::uint32_t>(edges.size());
+                edges.push_back({q, classSize[cls]});
+            }
+        }
+    }
+    edgeStart.push_back(static_cast<std::uint32_t>(edges.size()));
+}
+
+std::vector<BigCount> LanguageCounter::countByLength(std::size_t maxLength) const {
+    // reach[q] = number of strings of the current length that lead to q
+    std::vector<BigCount> reach(stateCount), next(stateCount);
+    reach[initial] = BigCount(1);
+
+    std::vector<BigCount> counts;
+    counts.reserve(maxLength + 1);
+    for (std::size_t length = 0;; ++length) {
+        BigCount total;
+        for (std::uint32_t q = 0; q < stateCount; ++q) {
+            if (accepting[q]) total += reach[q];
+        }
+        counts.push_back(std::move(total));
+        if (length == maxLength) break;
+
+        for (BigCount &c : next) c = BigCount();
+        for (std::uint32_t p = 0; p < stateCount; ++p) {
+            if (reach[p].isZero()) continue;
+            for (std::uint32_t e = edgeStart[p]; e < edgeStart[p + 1]; ++e) {
+                next[edges[e].target].addProduct(reach[p], edges[e].weight);
+            }
+        }
+        reach.swap(next);
+    }
+    return counts;
+}
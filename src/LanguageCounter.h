@@ -0,0 +1,57 @@
+/**
+ * @file LanguageCounter.h
+ * @brief Counting accepted strings by length with dynamic programming
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef LANGUAGECOUNTER_H
+#define LANGUAGECOUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BigCount.h"
+#include "CompiledDFA.h"
+
+/**
+ * @brief Counts the strings of each length accepted by a DFA without listing them
+ *
+ * The DFA is viewed as a weighted graph: the edge p -> q carries the number of
+ * input bytes that lead from p to q (byte classes make this a single entry per
+ * class). The number of strings of length k that reach each state is then one
+ * matrix-vector product away from length k - 1, so counting every length up
+ * to n costs O(n · |edges|) big-integer additions instead of |Σ|^n membership
+ * tests. Counts are exact, whatever their size.
+ */
+class LanguageCounter {
+public:
+    /**
+     * @brief Build the weighted edge lists of a compiled DFA
+     * @param dfa The automaton to count; it is not referenced after construction
+     */
+    explicit LanguageCounter(const CompiledDFA &dfa);
+
+    /**
+     * @brief Number of accepted strings of every length
+     * @param maxLength Largest length to count
+     * @return Element k is the number of accepted strings of length k, for k = 0..maxLength
+     */
+    std::vector<BigCount> countByLength(std::size_t maxLength) const;
+
+private:
+    /// Edge p -> target taken by `weight` distinct bytes.
+    struct Edge {
+        std::uint32_t target;
+        std::uint32_t weight;
+    };
+
+    std::uint32_t stateCount;
+    std::uint32_t initial;
+    std::vector<std::uint32_t> edgeStart; ///< Edges of row p are edges[edgeStart[p] .. edgeStart[p + 1])
+    std::vector<Edge> edges;
+    std::vector<char> accepting;
+};
+
+#endif // LANGUAGECOUNTER_H
@@ -0,0 +1,109 @@
+/**
+ * @file LazyDFA.cpp
+ * @brief Implementation of the LazyDFA class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "LazyDFA.h"
+
+namespace {
+
+std::uint64_t hashSet(const StateBitset &set) {
+    std::uint64_t h = 1469598103934665603ull;
+    for (std::size_t i = 0; i < set.wordCount(); ++i) {
+        h ^= set.data()[i];
+        h *= 1099511628211ull;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+} // namespace
+
+LazyDFA::LazyDFA(const Transition &t,
+                 const std::string &initialState,
+                 const std::set<std::string> &finalStates,
+                 std::size_t memoryBudget)
+    : nfa(t, initialState, finalStates),
+      memoryBudget(memoryBudget),
+      classCount(nfa.getClassCount()),
+      scratch(nfa.getStateCount()) {
+    for (int b = 255; b >= 0; --b) {
+        representative[nfa.getByteClass(static_cast<unsigned char>(b))] = static_cast<unsigned char>(b);
+    }
+}
+
+std::size_t LazyDFA::stateCost() const {
+    // Set words, one table row, the flags and the index entry
+    return scratch.wordCount() * sizeof(std::uint64_t) +
+           classCount * sizeof(std::uint32_t) + 2 + sizeof(std::uint32_t) + 32;
+}
+
+void LazyDFA::clearCache() {
+    sets.clear();
+    table.clear();
+    accepting.clear();
+    dead.clear();
+    index.clear();
+    memory = 0;
+    start = UNKNOWN;
+}
+
+std::uint32_t LazyDFA::intern(const StateBitset &set) {
+    const std::uint64_t h = hashSet(set);
+    auto it = index.find(h);
+    if (it != index.end()) {
+        for (std::uint32_t id : it->second) {
+            if (sets[id] == set) return id;
+        }
+    }
+
+    // Over budget: drop everything and keep building from this set
+    if (!sets.empty() && memory + stateCost() > memoryBudget) {
+        clearCache();
+        ++stats.flushes;
+    }
+
+    std::uint32_t id = static_cast<std::uint32_t>(sets.size());
+    sets.push_back(set);
+    table.resize(table.size() + classCount, UNKNOWN);
+    accepting.push_back(set.intersects(nfa.getAcceptSet()) ? 1 : 0);
+    dead.push_back(set.any() ? 0 : 1);
+    index[h].push_back(id);
+    memory += stateCost();
+    return id;
+}
+
+bool LazyDFA::accepts(const std::string &input) {
+    return accepts(input.data(), input.size());
+}
+
+bool LazyDFA::accepts(const char *data, std::size_t length) {
+    if (start == UNKNOWN) start = intern(nfa.getInitialSet());
+
+    std::uint32_t state = start;
+    for (std::size_t i = 0; i < length; ++i) {
+        if (dead[state]) break; // the empty set only loops to itself
+
+        const std::uint32_t column = nfa.getByteClass(static_cast<unsigned char>(data[i]));
+        const std::size_t slot = static_cast<std::size_t>(state) * classCount + column;
+        std::uint32_t target = table[slot];
+        if (target != UNKNOWN) {
+            ++stats.hits;
+            state = target;
+            continue;
+        }
+
+        ++stats.misses;
+        nfa.step(sets[state], representative[column], scratch);
+        const std::uint64_t flushesBefore = stats.flushes;
+        target = intern(scratch);
+        if (stats.flushes == flushesBefore) {
+            table[slot] = target;
+        }
+        state = target;
+    }
+    return accepting[state] != 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file LazyDFA.h
+ * @brief On-the-fly subset construction with a bounded transition cache
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef LAZYDFA_H
+#define LAZYDFA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "NFASimulator.h"
+#include "StateBitset.h"
+#include "Transition.h"
+
+/**
+ * @brief Executes an NFA as a DFA whose states are built while scanning
+ *
+ * A DFA state is a set of NFA states. The first time a (state, byte class)
+ * transition is taken, its target set is computed with one NFASimulator step
+ * and cached; later visits are a single table lookup, as in CompiledDFA. Only
+ * the states the inputs actually reach are ever built, so automata whose full
+ * subset construction explodes still run at DFA speed on typical inputs.
+ *
+ * The cache is bounded by a memory budget. When building a new state would
+ * exceed it, every cached state is discarded and construction restarts from
+ * the current set, so memory stays bounded even on adversarial inputs.
+ *
+ * Scanning updates the cache, so a LazyDFA must not be shared between threads.
+ */
+class LazyDFA {
+public:
+    /// Cache activity since construction or the last resetStats().
+    struct Stats {
+        std::uint64_t hits = 0;    ///< Transitions found in the cache
+        std::uint64_t misses = 0;  ///< Transitions computed from the NFA
+        std::uint64_t flushes = 0; ///< Times the cache was cleared to respect the budget
+    };
+
+    /// Default cache budget: 1 MiB.
+    static constexpr std::size_t DEFAULT_MEMORY_BUDGET = std::size_t(1) << 20;
+
+    /**
+     * @brief Prepare the NFA; no DFA state is built yet
+     * @param t The transition function (ε-moves allowed)
+     * @param initialState The initial state
+     * @param finalStates The set of accepting states
+     * @param memoryBudget Approximate maximum size of the cache in bytes
+     */
+    LazyDFA(const Transition &t,
+            const std::string &initialState,
+            const std::set<std::string> &finalStates,
+            std::size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+    /**
+     * @brief Decide membership of a string, extending the cache as needed
+     */
+    bool accepts(const std::string &input);
+
+    /**
+     * @brief Decide membership of a raw byte range
+     */
+    bool accepts(const char *data, std::size_t length);
+
+    /// Cache statistics.
+    const Stats &getStats() const { return stats; }
+
+    /// Zero the cache statistics.
+    void resetStats() { stats = Stats(); }
+
+    /// Number of DFA states currently cached.
+    std::size_t getCachedStateCount() const { return sets.size(); }
+
+    /// Approximate bytes used by the cached states.
+    std::size_t getMemoryUsage() const { return memory; }
+
+    /// Cache budget in bytes.
+    std::size_t getMemoryBudget() const { return memoryBudget; }
+
+    /// Discard every cached state (statistics are kept).
+    void clearCache();
+
+private:
+    static constexpr std::uint32_t UNKNOWN = 0xFFFFFFFFu;
+
+    /// Id of the cached state for a set, building it (and maybe flushing) if needed.
+    std::uint32_t intern(const StateBitset &set);
+
+    /// Bytes charged to the budget for one cached state.
+    std::size_t stateCost() const;
+
+    NFASimulator nfa;
+    std::size_t memoryBudget;
+    std::size_t memory = 0;
+    std::uint32_t classCount;
+    std::array<unsigned char, 256> representative{}; ///< One byte of every class
+
+    std::vector<StateBitset> sets;          ///< NFA set of every cached state
+    std::vector<std::uint32_t> table;       ///< [state][class] -> cached target, or UNKNOWN
+    std::vector<char> accepting;            ///< Whether each cached state accepts
+    std::vector<char> dead;                 ///< Whether each cached state is the empty set
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> index; ///< Set hash -> ids
+    std::uint32_t start = UNKNOWN;          ///< Cached id of the initial set
+    StateBitset scratch;                    ///< Target set of the transition being built
+    Stats stats;
+};
+
+#endif // LAZYDFA_H
@@ -0,0 +1,246 @@
+/**
+ * @file Minimization.cpp
+ * @brief Implementation of Hopcroft's DFA minimization
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "Minimization.h"
+#include "CompiledDFA.h"
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+/**
+ * @brief Partition of 0..n-1 into blocks, stored as contiguous ranges of one array
+ *
+ * Marking an element moves it to the front of its block's range, so splitting a
+ * block into its marked and unmarked parts only moves the range boundary.
+ */
+struct Partition {
+    std::vector<std::uint32_t> elems;   ///< Elements grouped by block
+    std::vector<std::uint32_t> loc;     ///< Position of each element in elems
+    std::vector<std::uint32_t> blockOf; ///< Block of each element
+    std::vector<std::uint32_t> first;   ///< First position of each block
+    std::vector<std::uint32_t> end;     ///< One past the last position of each block
+    std::vector<std::uint32_t> marked;  ///< Number of marked elements at the front of each block
+
+    std::uint32_t size(std::uint32_t b) const { return end[b] - first[b]; }
+
+    void mark(std::uint32_t e) {
+        std::uint32_t b = blockOf[e];
+        std::uint32_t target = first[b] + marked[b];
+        std::uint32_t other = elems[target];
+        std::swap(elems[loc[e]], elems[target]);
+        loc[other] = loc[e];
+        loc[e] = target;
+        ++marked[b];
+    }
+
+    /// Move the marked prefix of b into a new block and return its index.
+    std::uint32_t split(std::uint32_t b) {
+        std::uint32_t nb = static_cast<std::uint32_t>(first.size());
+        first.push_back(first[b]);
+        end.push_back(first[b] + marked[b]);
+        marked.push_back(0);
+        first[b] += marked[b];
+        marked[b] = 0;
+        for (std::uint32_t i = first[nb]; i < end[nb]; ++i) blockOf[elems[i]] = nb;
+        return nb;
+    }
+};
+
+} // namespace
+
+MinimizationResult minimize(const DeterministicAutomaton &dfa) {
+    const Transition &t = dfa.delta;
+    if (!CompiledDFA::isDeterministic(t)) {
+        throw std::invalid_argument("minimize: the automaton is not deterministic");
+    }
+
+    MinimizationResult result;
+    DeterministicAutomaton &out = result.automaton;
+
+    StateId start = t.getStateId(dfa.initialState);
+    if (start == Transition::INVALID_STATE) {
+        // No transitions at all: the language is either {ε} or empty
+        out.initialState = "q0";
+        if (dfa.finalStates.count(dfa.initialState)) out.finalStates.insert("q0");
+        result.stateMapping[dfa.initialState] = "q0";
+        return result;
+    }
+
+    const std::vector<char> symbols = t.getSymbols();
+    const std::size_t k = symbols.size();
+
+    // 1. Keep only reachable states, renumbered 0..n-1 in BFS order
+    std::vector<std::uint32_t> local(t.getStateCount(), NONE);
+    std::vector<StateId> original;
+    local[start] = 0;
+    original.push_back(start);
+    for (std::size_t i = 0; i < original.size(); ++i) {
+        for (char c : symbols) {
+            for (StateId d : t.getNextStates(original[i], c)) {
+                if (local[d] == NONE) {
+                    local[d] = static_cast<std::uint32_t>(original.size());
+                    original.push_back(d);
+                }
+            }
+        }
+    }
+
+    // 2. Complete the automaton with an explicit dead state
+    const std::uint32_t n = static_cast<std::uint32_t>(original.size());
+    const std::uint32_t dead = n;
+    const std::uint32_t total = n + 1;
+    std::vector<std::uint32_t> next(static_cast<std::size_t>(total) * k, dead);
+    for (std::uint32_t q = 0; q < n; ++q) {
+        for (std::size_t a = 0; a < k; ++a) {
+            StateSpan d = t.getNextStates(original[q], symbols[a]);
+            if (!d.empty()) next[q * k + a] = local[d.front()];
+        }
+    }
+
+    std::vector<char> isFinal(total, 0);
+    for (std::uint32_t q = 0; q < n; ++q) {
+        isFinal[q] = dfa.finalStates.count(t.getStateName(original[q])) ? 1 : 0;
+    }
+
+    // Inverse transitions per symbol in CSR form: preds of q on a are
+    // invList[invStart[a * total + q] .. invStart[a * total + q + 1])
+    std::vector<std::uint32_t> invStart(k * total + 1, 0);
+    for (std::uint32_t q = 0; q < total; ++q) {
+        for (std::size_t a = 0; a < k; ++a) ++invStart[a * total + next[q * k + a] + 1];
+    }
+    for (std::size_t i = 1; i < invStart.size(); ++i) invStart[i] += invStart[i - 1];
+    std::vector<std::uint32_t> invList(invStart.back());
+    {
+        std::vector<std::uint32_t> fill(invStart.begin(), invStart.end() - 1);
+        for (std::uint32_t q = 0; q < total; ++q) {
+            for (std::size_t a = 0; a < k; ++a) invList[fill[a * total + next[q * k + a]]++] = q;
+        }
+    }
+
+    // 3. Initial partition {F, Q \ F}
+    Partition p;
+    p.elems.reserve(total);
+    for (std::uint32_t q = 0; q < total; ++q) if (isFinal[q]) p.elems.push_back(q);
+    std::uint32_t finalCount = static_cast<std::uint32_t>(p.elems.size());
+    for (std::uint32_t q = 0; q < total; ++q) if (!isFinal[q]) p.elems.push_back(q);
+    p.loc.resize(total);
+    p.blockOf.resize(total);
+    for (std::uint32_t i = 0; i < total; ++i) p.loc[p.elems[i]] = i;
+
+    if (finalCount == 0) {
+        p.first = {0};
+        p.end = {total};
+        p.marked = {0};
+        std::fill(p.blockOf.begin(), p.blockOf.end(), 0);
+    } else {
+        // The dead state is never final, so both blocks are non-empty
+        p.first = {0, finalCount};
+        p.end = {finalCount, total};
+        p.marked = {0, 0};
+        for (std::uint32_t i = 0; i < total; ++i) p.blockOf[p.elems[i]] = i < finalCount ? 0 : 1;
+    }
+
+    // Worklist of (block, symbol) splitters; start with the smaller initial block
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> work;
+    std::vector<char> inWork(p.first.size() * k, 0);
+    if (p.first.size() == 2) {
+        std::uint32_t smaller = p.size(0) <= p.size(1) ? 0 : 1;
+        for (std::uint32_t a = 0; a < k; ++a) {
+            work.emplace_back(smaller, a);
+            inWork[smaller * k + a] = 1;
+        }
+    }
+
+    std::vector<std::uint32_t> preds;
+    std::vector<std::uint32_t> touched;
+    while (!work.empty()) {
+        auto [splitter, a] = work.back();
+        work.pop_back();
+        inWork[splitter * k + a] = 0;
+
+        // Collect every state that moves into the splitter on a
+        preds.clear();
+        for (std::uint32_t i = p.first[splitter]; i < p.end[splitter]; ++i) {
+            std::uint32_t q = p.elems[i];
+            std::size_t base = a * total + q;
+            preds.insert(preds.end(), invList.begin() + invStart[base], invList.begin() + invStart[base + 1]);
+        }
+
+        // Deterministic: each state has one successor on a, so it appears once
+        for (std::uint32_t s : preds) {
+            std::uint32_t b = p.blockOf[s];
+            if (p.marked[b] == 0) touched.push_back(b);
+            p.mark(s);
+        }
+
+        for (std::uint32_t b : touched) {
+            if (p.marked[b] == p.size(b)) {
+                p.marked[b] = 0; // every element moves: no split
+                continue;
+            }
+            std::uint32_t nb = p.split(b);
+            inWork.resize(p.first.size() * k, 0);
+            for (std::uint32_t c = 0; c < k; ++c) {
+                std::uint32_t add = inWork[b * k + c] ? nb : (p.size(nb) <= p.size(b) ? nb : b);
+                if (!inWork[add * k + c]) {
+                    inWork[add * k + c] = 1;
+                    work.emplace_back(add, c);
+                }
+            }
+        }
+        touched.clear();
+    }
+
+    // 4. Build the quotient automaton, skipping the dead block
+    const std::uint32_t deadBlock = p.blockOf[dead];
+    const std::uint32_t blockCount = static_cast<std::uint32_t>(p.first.size());
+    std::vector<StateId> newId(blockCount, Transition::INVALID_STATE);
+    std::vector<std::uint32_t> order;
+
+    std::uint32_t initialBlock = p.blockOf[0];
+    out.initialState = "q0";
+    if (initialBlock == deadBlock) {
+        // Empty language
+        result.stateMapping[dfa.initialState] = "q0";
+        return result;
+    }
+
+    auto visit = [&](std::uint32_t b) -> StateId {
+        if (newId[b] == Transition::INVALID_STATE) {
+            newId[b] = out.delta.internState("q" + std::to_string(order.size()));
+            order.push_back(b);
+        }
+        return newId[b];
+    };
+    visit(initialBlock);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        std::uint32_t b = order[i];
+        std::uint32_t rep = p.elems[p.first[b]];
+        StateId from = newId[b];
+        if (isFinal[rep]) out.finalStates.insert(out.delta.getStateName(from));
+        for (std::size_t a = 0; a < k; ++a) {
+            std::uint32_t db = p.blockOf[next[rep * k + a]];
+            if (db == deadBlock) continue;
+            StateId to = visit(db);
+            out.delta.addTransition(from, symbols[a], to);
+        }
+    }
+
+    for (std::uint32_t q = 0; q < n; ++q) {
+        StateId id = newId[p.blockOf[q]];
+        if (id != Transition::INVALID_STATE) {
+            result.stateMapping[t.getStateName(original[q])] = out.delta.getStateName(id);
+        }
+    }
+
+    return result;
+}
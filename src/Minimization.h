@@ -0,0 +1,41 @@
+/**
+ * @file Minimization.h
+ * @brief Hopcroft's partition-refinement DFA minimization
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef MINIMIZATION_H
+#define MINIMIZATION_H
+
+#include <map>
+#include <string>
+#include "Determinization.h"
+
+/**
+ * @brief Result of minimize(): the minimal DFA and where each old state went
+ */
+struct MinimizationResult {
+    DeterministicAutomaton automaton;               ///< The minimal automaton
+    std::map<std::string, std::string> stateMapping; ///< Old state name -> new state name
+};
+
+/**
+ * @brief Minimize a deterministic automaton with Hopcroft's algorithm
+ *
+ * Runs in O(n |Σ| log n). Unreachable states are discarded first, and states
+ * from which no final state can be reached are merged into the implicit dead
+ * state and dropped, so the result is the minimal partial DFA. Its states are
+ * named q0, q1, ... in breadth-first order from the initial state.
+ *
+ * States that were unreachable or dead have no entry in stateMapping.
+ *
+ * @param dfa A deterministic automaton (at most one destination per (state, symbol)
+ *            and no epsilon transitions)
+ * @return The minimized automaton and the old -> new state mapping
+ * @throws std::invalid_argument If the automaton is not deterministic
+ */
+MinimizationResult minimize(const DeterministicAutomaton &dfa);
+
+#endif // MINIMIZATION_H
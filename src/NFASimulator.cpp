@@ -0,0 +1,83 @@
+/**
+ * @file NFASimulator.cpp
+ * @brief Implementation of the NFASimulator class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "NFASimulator.h"
+#include "ByteClasses.h"
+#include "EpsilonClosure.h"
+
+NFASimulator::NFASimulator(const Transition &t,
+                           const std::string &initialState,
+                           const std::set<std::string> &finalStates) {
+    // An initial state without transitions is not interned; give it the next id
+    stateCount = t.getStateCount();
+    StateId initial = t.getStateId(initialState);
+    if (initial == Transition::INVALID_STATE) {
+        initial = static_cast<StateId>(stateCount++);
+    }
+    wordsPerRow = (stateCount + 63) / 64;
+
+    // Epsilon moves are folded into the rows: each destination contributes its closure
+    const EpsilonClosure closure(t, stateCount);
+
+    // Epsilon is never an input byte, so it stays in class 0
+    const ByteClasses classes(t);
+    byteClass = classes.getMap();
+    classCount = classes.getClassCount();
+
+    // One successor row per (state, byte class) pair that has transitions
+    rowIndex.assign(stateCount * classCount, NO_ROW);
+    t.forEachTransition([&](StateId from, char symbol, StateSpan to) {
+        if (symbol == Transition::EPSILON) return;
+        std::uint32_t &slot = rowIndex[from * classCount + byteClass[static_cast<unsigned char>(symbol)]];
+        if (slot != NO_ROW) return; // another symbol of the class built this row
+        std::uint32_t row = static_cast<std::uint32_t>(successors.size() / wordsPerRow);
+        slot = row;
+        successors.resize(successors.size() + wordsPerRow, 0);
+        std::uint64_t *bits = successors.data() + static_cast<std::size_t>(row) * wordsPerRow;
+        for (StateId dest : to) closure.addClosure(dest, bits);
+    });
+
+    initialSet = StateBitset(stateCount);
+    closure.addClosure(initial, initialSet);
+
+    acceptSet = StateBitset(stateCount);
+    for (const std::string &name : finalStates) {
+        if (name == initialState) {
+            acceptSet.set(initial);
+            continue;
+        }
+        StateId id = t.getStateId(name);
+        if (id != Transition::INVALID_STATE) acceptSet.set(id);
+    }
+}
+
+void NFASimulator::step(const StateBitset &current, unsigned char byte, StateBitset &next) const {
+    next.clear();
+    std::uint32_t column = byteClass[byte];
+    if (column == 0) return; // no state has a transition on this byte
+
+    current.forEach([&](std::uint32_t state) {
+        std::uint32_t row = rowIndex[state * classCount + column];
+        if (row != NO_ROW) next.orWith(successors.data() + static_cast<std::size_t>(row) * wordsPerRow);
+    });
+}
+
+StateBitset NFASimulator::run(const std::string &input) const {
+    StateBitset current = initialSet;
+    StateBitset next(stateCount);
+    for (char c : input) {
+        step(current, static_cast<unsigned char>(c), next);
+        current.swap(next);
+        if (!current.any()) break; // every run died
+    }
+    return current;
+}
+
+bool NFASimulator::accepts(const std::string &input) const {
+    return run(input).intersects(acceptSet);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file NFASimulator.h
+ * @brief Bitset-parallel simulation of nondeterministic automata
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef NFASIMULATOR_H
+#define NFASIMULATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+#include "StateBitset.h"
+#include "Transition.h"
+
+/**
+ * @brief Simulates an NFA on the set of active states, one symbol at a time
+ *
+ * For every (state, symbol) pair with at least one transition, the successor
+ * set is precomputed as a bitset row. Advancing on a symbol ORs together the
+ * rows of the active states, so a step costs O(active states x |Q|/64) word
+ * operations and never allocates. Unlike a search over (state, position)
+ * configurations, each state is processed at most once per input position.
+ *
+ * Epsilon transitions are resolved at construction: every row and the initial
+ * set already contain the epsilon closures of their states, so an ε-NFA runs
+ * exactly as fast as an NFA of the same size.
+ *
+ * The simulator is immutable after construction and can be shared by several
+ * threads, as long as each thread uses its own StateBitset buffers.
+ */
+class NFASimulator {
+public:
+    /**
+     * @brief Precompute the successor rows of an automaton
+     * @param t The transition function
+     * @param initialState The initial state (it may have no transitions at all)
+     * @param finalStates The set of accepting states
+     */
+    NFASimulator(const Transition &t,
+                 const std::string &initialState,
+                 const std::set<std::string> &finalStates);
+
+    /**
+     * @brief Decide membership of a string
+     * @return true if some run over the input ends in an accepting state
+     */
+    bool accepts(const std::string &input) const;
+
+    /**
+     * @brief Run the automaton over an input
+     * @return The set of states active after reading the whole input
+     */
+    StateBitset run(const std::string &input) const;
+
+    /**
+     * @brief Advance a state set on one input byte
+     * @param current Active states before the symbol
+     * @param byte The input byte
+     * @param next Receives the active states after the symbol (overwritten)
+     */
+    void step(const StateBitset &current, unsigned char byte, StateBitset &next) const;
+
+    /// States active before reading any input.
+    const StateBitset &getInitialSet() const { return initialSet; }
+
+    /// Accepting states.
+    const StateBitset &getAcceptSet() const { return acceptSet; }
+
+    /// Number of states, i.e. the size of every StateBitset used by this simulator.
+    std::size_t getStateCount() const { return stateCount; }
+
+    /// Number of byte classes; class 0 holds the bytes without transitions.
+    std::uint32_t getClassCount() const { return classCount; }
+
+    /// Byte class of an input byte. Bytes of the same class have the same successors.
+    std::uint8_t getByteClass(unsigned char byte) const { return byteClass[byte]; }
+
+private:
+    static constexpr std::uint32_t NO_ROW = 0xFFFFFFFFu;
+
+    std::size_t stateCount = 0;
+    std::size_t wordsPerRow = 0;
+    std::uint32_t classCount = 1;
+    std::array<std::uint8_t, 256> byteClass{}; ///< Input byte -> column, 0 = no transitions
+    std::vector<std::uint32_t> rowIndex;       ///< [state][class] -> row in successors, or NO_ROW
+    std::vector<std::uint64_t> successors;     ///< Packed successor bitset rows
+    StateBitset initialSet;
+    StateBitset acceptSet;
+};
+
+#endif // NFASIMULATOR_H
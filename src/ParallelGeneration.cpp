@@ -0,0 +1,131 @@
+/**
+ * @file ParallelGeneration.cpp
+ * @brief Implementation of generateShortlexParallel()
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "ParallelGeneration.h"
+#include <cstdint>
+#include <utility>
+#include "Transition.h"
+
+namespace {
+
+/// The DFA restricted to the requested alphabet, with reachability to acceptance.
+struct SearchGraph {
+    std::vector<char> symbols;
+    std::uint32_t stateCount = 0;
+    std::vector<std::uint32_t> moves; ///< [state][symbol index] -> target row
+    std::vector<char> within;         ///< [r][state] -> an accepting state is reachable in <= r steps
+
+    bool canFinish(std::size_t remaining, std::uint32_t state) const {
+        return within[remaining * stateCount + state] != 0;
+    }
+    bool accepting(std::uint32_t state) const { return within[state] != 0; }
+    std::uint32_t next(std::uint32_t state, std::size_t i) const { return moves[state * symbols.size() + i]; }
+};
+
+SearchGraph buildGraph(const CompiledDFA &dfa, const std::vector<char> &alphabet, std::size_t maxLength) {
+    SearchGraph g;
+    bool seen[256] = {};
+    for (char c : alphabet) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (c == Transition::EPSILON || seen[byte]) continue;
+        seen[byte] = true;
+        g.symbols.push_back(c);
+    }
+
+    const std::size_t k = g.symbols.size();
+    g.stateCount = dfa.getStateCount();
+    g.moves.resize(static_cast<std::size_t>(g.stateCount) * k);
+    for (std::uint32_t p = 0; p < g.stateCount; ++p) {
+        for (std::size_t i = 0; i < k; ++i) {
+            g.moves[p * k + i] = dfa.next(p, static_cast<unsigned char>(g.symbols[i]));
+        }
+    }
+
+    g.within.assign((maxLength + 1) * g.stateCount, 0);
+    for (std::uint32_t p = 0; p < g.stateCount; ++p) g.within[p] = dfa.isAccepting(p) ? 1 : 0;
+    for (std::size_t r = 1; r <= maxLength; ++r) {
+        for (std::uint32_t p = 0; p < g.stateCount; ++p) {
+            char ok = g.within[(r - 1) * g.stateCount + p];
+            for (std::size_t i = 0; i < k && !ok; ++i) ok = g.canFinish(r - 1, g.next(p, i));
+            g.within[r * g.stateCount + p] = ok;
+        }
+    }
+    return g;
+}
+
+/// Depth-first search below a prefix; buckets[j] receives the strings of length base + j.
+void explore(const SearchGraph &g, std::uint32_t state, std::string &buffer, std::size_t maxLength,
+             std::size_t base, std::vector<std::vector<std::string>> &buckets) {
+    const std::size_t remaining = maxLength - buffer.size();
+    if (remaining == 0) return;
+    for (std::size_t i = 0; i < g.symbols.size(); ++i) {
+        const std::uint32_t target = g.next(state, i);
+        if (!g.canFinish(remaining - 1, target)) continue;
+        buffer.push_back(g.symbols[i]);
+        if (g.accepting(target)) buckets[buffer.size() - base].push_back(buffer);
+        explore(g, target, buffer, maxLength, base, buckets);
+        buffer.pop_back();
+    }
+}
+
+/// A live node of the breadth-first expansion.
+struct Prefix {
+    std::uint32_t state;
+    std::string text;
+};
+
+} // namespace
+
+std::vector<std::string> generateShortlexParallel(const CompiledDFA &dfa,
+                                                  const std::vector<char> &alphabet,
+                                                  std::size_t maxLength,
+                                                  ThreadPool &pool,
+                                                  std::size_t splitDepth) {
+    const SearchGraph g = buildGraph(dfa, alphabet, maxLength);
+    const std::size_t wanted = static_cast<std::size_t>(pool.getThreadCount()) * 8;
+
+    std::vector<std::string> out;
+    std::vector<Prefix> level;
+    if (g.canFinish(maxLength, dfa.getInitialState())) level.push_back({dfa.getInitialState(), std::string()});
+
+    // Breadth-first down to the split depth; each level is one length, already in shortlex order
+    std::size_t depth = 0;
+    for (;; ++depth) {
+        for (const Prefix &p : level) {
+            if (g.accepting(p.state)) out.push_back(p.text);
+        }
+        if (level.empty() || depth == maxLength) return out;
+        if (splitDepth == AUTO_SPLIT_DEPTH ? level.size() >= wanted : depth >= splitDepth) break;
+
+        std::vector<Prefix> next;
+        const std::size_t remaining = maxLength - depth;
+        for (const Prefix &p : level) {
+            for (std::size_t i = 0; i < g.symbols.size(); ++i) {
+                const std::uint32_t target = g.next(p.state, i);
+                if (g.canFinish(remaining - 1, target)) next.push_back({target, p.text + g.symbols[i]});
+            }
+        }
+        level = std::move(next);
+    }
+
+    // One task per prefix; buckets[j][l] holds the strings of length depth + l below prefix j
+    std::vector<std::vector<std::vector<std::string>>> buckets(level.size());
+    pool.parallelFor(level.size(), [&](std::size_t j) {
+        buckets[j].resize(maxLength - depth + 1);
+        std::string buffer = level[j].text;
+        buffer.reserve(maxLength);
+        explore(g, level[j].state, buffer, maxLength, depth, buckets[j]);
+    });
+
+    for (std::size_t l = 1; l <= maxLength - depth; ++l) {
+        for (auto &perPrefix : buckets) {
+            for (std::string &s : perPrefix[l]) out.push_back(std::move(s));
+        }
+    }
+    return out;
+}
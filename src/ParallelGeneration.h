@@ -0,0 +1,52 @@
+/**
+ * @file ParallelGeneration.h
+ * @brief Multithreaded shortlex enumeration of accepted strings
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef PARALLELGENERATION_H
+#define PARALLELGENERATION_H
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+#include "CompiledDFA.h"
+#include "ThreadPool.h"
+
+/// Let generateShortlexParallel() pick the split depth from the pool size.
+constexpr std::size_t AUTO_SPLIT_DEPTH = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Enumerate every accepted string up to a length, in shortlex order, on a thread pool
+ *
+ * The search tree is expanded breadth-first down to a split depth d; the
+ * strings shorter than or equal to d come out of that expansion directly.
+ * Each live prefix of length d then roots an independent subtree, explored
+ * depth-first by one task into per-length buckets. Tasks are handed out to
+ * the pool one prefix at a time, so threads that finish early keep taking
+ * subtrees and unbalanced trees still spread across cores. Finally, for
+ * every length the buckets are concatenated in prefix order, which is
+ * exactly shortlex order.
+ *
+ * Only branches from which an accepting state is reachable within the
+ * remaining length are entered, and each string is produced once.
+ *
+ * @param dfa The automaton
+ * @param alphabet Symbols to enumerate over, in output order; duplicates and
+ *                 the epsilon symbol are ignored
+ * @param maxLength Longest string to produce
+ * @param pool Threads that explore the subtrees
+ * @param splitDepth Prefix length at which the tree is split; by default, the
+ *                   first depth with at least 8 live prefixes per thread
+ * @return The accepted strings, shortest first and in alphabet order within a length
+ */
+std::vector<std::string> generateShortlexParallel(const CompiledDFA &dfa,
+                                                  const std::vector<char> &alphabet,
+                                                  std::size_t maxLength,
+                                                  ThreadPool &pool = ThreadPool::global(),
+                                                  std::size_t splitDepth = AUTO_SPLIT_DEPTH);
+
+#endif // PARALLELGENERATION_H
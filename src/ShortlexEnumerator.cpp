@@ -0,0 +1,111 @@
+/**
+ * @file ShortlexEnumerator.cpp
+ * @brief Implementation of the ShortlexEnumerator class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "ShortlexEnumerator.h"
+#include "Transition.h"
+
+ShortlexEnumerator::ShortlexEnumerator(const CompiledDFA &dfa,
+                                       const std::vector<char> &alphabet,
+                                       std::size_t maxLength)
+    : maxLength(maxLength), stateCount(dfa.getStateCount()), initial(dfa.getInitialState()) {
+    bool seen[256] = {};
+    for (char c : alphabet) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (c == Transition::EPSILON || seen[byte]) continue;
+        seen[byte] = true;
+        symbols.push_back(c);
+    }
+
+    const std::size_t k = symbols.size();
+    moves.resize(static_cast<std::size_t>(stateCount) * k);
+    for (std::uint32_t p = 0; p < stateCount; ++p) {
+        for (std::size_t i = 0; i < k; ++i) {
+            moves[p * k + i] = dfa.next(p, static_cast<unsigned char>(symbols[i]));
+        }
+    }
+
+    // live[r][p]: some move from p reaches a state live at r - 1
+    live.assign((maxLength + 1) * stateCount, 0);
+    for (std::uint32_t p = 0; p < stateCount; ++p) {
+        live[p] = dfa.isAccepting(p) ? 1 : 0;
+    }
+    for (std::size_t r = 1; r <= maxLength; ++r) {
+        for (std::uint32_t p = 0; p < stateCount; ++p) {
+            for (std::size_t i = 0; i < k; ++i) {
+                if (isLive(r - 1, moves[p * k + i])) {
+                    live[r * stateCount + p] = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    frames.reserve(maxLength + 1);
+    buffer.reserve(maxLength);
+}
+
+void ShortlexEnumerator::reset() {
+    length = 0;
+    begun = false;
+    atLeaf = false;
+    frames.clear();
+    buffer.clear();
+}
+
+void ShortlexEnumerator::popFrame() {
+    frames.pop_back();
+    if (!buffer.empty()) buffer.pop_back();
+}
+
+bool ShortlexEnumerator::next() {
+    if (atLeaf) {
+        popFrame();
+        atLeaf = false;
+    }
+
+    const std::size_t k = symbols.size();
+    for (;;) {
+        if (frames.empty()) {
+            // The search for this length is over (or never started): go to the next one
+            if (begun) ++length;
+            begun = true;
+            if (length > maxLength) {
+                length = maxLength + 1; // stay exhausted on further calls
+                return false;
+            }
+            if (!isLive(length, initial)) continue;
+            frames.push_back({initial, 0});
+            if (length == 0) {
+                atLeaf = true;
+                return true;
+            }
+            continue;
+        }
+
+        // Try the remaining symbols of the top frame; only live targets are entered
+        const std::size_t remaining = length - buffer.size();
+        Frame &top = frames.back();
+        bool descended = false;
+        while (top.symbol < k) {
+            const std::uint32_t i = top.symbol++;
+            const std::uint32_t target = moves[top.state * k + i];
+            if (!isLive(remaining - 1, target)) continue;
+            buffer.push_back(symbols[i]);
+            frames.push_back({target, 0}); // invalidates top
+            descended = true;
+            break;
+        }
+
+        if (!descended) {
+            popFrame();
+        } else if (remaining == 1) {
+            atLeaf = true;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * @file ShortlexEnumerator.h
+ * @brief Lazy enumeration of accepted strings in shortlex order
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef SHORTLEXENUMERATOR_H
+#define SHORTLEXENUMERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CompiledDFA.h"
+
+/**
+ * @brief Yields the accepted strings of a DFA one at a time, shortest first
+ *
+ * Strings come out by increasing length and, within a length, in the order of
+ * the alphabet given to the constructor. Each one is produced exactly once,
+ * because the automaton is deterministic.
+ *
+ * For each length the enumerator runs a depth-first search that keeps the
+ * current prefix in a single buffer and a stack of (state, next symbol)
+ * frames, so advancing never allocates. A precomputed table tells, for every
+ * state and remaining length r, whether some accepted string of exactly length
+ * r starts there; branches that cannot complete are never entered, so the cost
+ * of each result is O(length · |Σ|) whatever the size of the rejected space.
+ *
+ * The enumerator is resumable: a caller that stops after k results pays only
+ * for those k.
+ */
+class ShortlexEnumerator {
+public:
+    /**
+     * @brief Prepare the enumeration; no string is produced yet
+     * @param dfa The automaton; it is not referenced after construction
+     * @param alphabet Symbols to enumerate over, in output order; duplicates and
+     *                 the epsilon symbol are ignored
+     * @param maxLength Longest string to produce
+     */
+    ShortlexEnumerator(const CompiledDFA &dfa, const std::vector<char> &alphabet, std::size_t maxLength);
+
+    /**
+     * @brief Advance to the next accepted string
+     * @return false once every accepted string up to maxLength was produced
+     */
+    bool next();
+
+    /// The string produced by the last successful next().
+    const std::string &current() const { return buffer; }
+
+    /// Start over from the empty string.
+    void reset();
+
+private:
+    /// DFS frame: a state on the current prefix and the next symbol to try from it.
+    struct Frame {
+        std::uint32_t state;
+        std::uint32_t symbol;
+    };
+
+    bool isLive(std::size_t remaining, std::uint32_t state) const {
+        return live[remaining * stateCount + state] != 0;
+    }
+
+    void popFrame();
+
+    std::vector<char> symbols;
+    std::size_t maxLength;
+    std::uint32_t stateCount;
+    std::uint32_t initial;
+    std::vector<std::uint32_t> moves; ///< [state][symbol index] -> target row
+    std::vector<char> live;           ///< [r][state] -> an accepted string of length r starts here
+
+    std::size_t length = 0;     ///< Length being enumerated
+    bool begun = false;         ///< Whether the search for `length` has started
+    bool atLeaf = false;        ///< Whether the top frame is the string last returned
+    std::vector<Frame> frames;  ///< Frame d is the state after buffer[0 .. d)
+    std::string buffer;         ///< Shared prefix of the search
+};
+
+#endif // SHORTLEXENUMERATOR_H
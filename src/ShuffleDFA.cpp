@@ -0,0 +1,234 @@
+/**
+ * @file ShuffleDFA.cpp
+ * @brief Implementation of the ShuffleDFA class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "ShuffleDFA.h"
+#include "CompiledDFA.h"
+#include <stdexcept>
+#include <string>
+
+// The SIMD kernels are compiled with per-function target attributes, so the
+// rest of the library keeps the baseline instruction set and the choice is
+// made at runtime. Other compilers and architectures only get the scalar loop.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define ZFLAP_SHUFFLE_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define ZFLAP_SHUFFLE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using Map = std::array<std::uint8_t, ShuffleDFA::MAX_STATES>;
+
+std::uint32_t runScalar(const Map *maps, std::uint32_t state,
+                        const unsigned char *data, std::size_t length) {
+    for (std::size_t i = 0; i < length; ++i) state = maps[data[i]][state];
+    return state;
+}
+
+#if defined(ZFLAP_SHUFFLE_X86)
+
+// Lane s of a segment map holds the row reached from row s. Following one byte
+// is m = maps[byte][m], i.e. PSHUFB with the byte's map as the table and the
+// current map as the indices.
+__attribute__((target("sse4.2")))
+std::uint32_t runSse42(const Map *maps, std::uint32_t state,
+                       const unsigned char *data, std::size_t length) {
+    constexpr std::size_t SEGMENTS = 4;
+    const std::size_t segment = length / SEGMENTS;
+    const unsigned char *p0 = data;
+    const unsigned char *p1 = p0 + segment;
+    const unsigned char *p2 = p1 + segment;
+    const unsigned char *p3 = p2 + segment;
+
+    const __m128i identity = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                           8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i m0 = identity, m1 = identity, m2 = identity, m3 = identity;
+    for (std::size_t i = 0; i < segment; ++i) {
+        m0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(maps[p0[i]].data())), m0);
+        m1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(maps[p1[i]].data())), m1);
+        m2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(maps[p2[i]].data())), m2);
+        m3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(maps[p3[i]].data())), m3);
+    }
+
+    alignas(16) std::uint8_t out[SEGMENTS][16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(out[0]), m0);
+    _mm_store_si128(reinterpret_cast<__m128i *>(out[1]), m1);
+    _mm_store_si128(reinterpret_cast<__m128i *>(out[2]), m2);
+    _mm_store_si128(reinterpret_cast<__m128i *>(out[3]), m3);
+    for (std::size_t k = 0; k < SEGMENTS; ++k) state = out[k][state];
+
+    const std::size_t done = SEGMENTS * segment;
+    return runScalar(maps, state, data + done, length - done);
+}
+
+// VPSHUFB shuffles each 128-bit half on its own, so every register carries
+// two segments: the even one in the low half and the odd one in the high half.
+__attribute__((target("avx2")))
+inline __m256i loadPair(const Map *maps, unsigned char low, unsigned char high) {
+    __m256i pair = _mm256_castsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(maps[low].data())));
+    return _mm256_inserti128_si256(
+        pair, _mm_loadu_si128(reinterpret_cast<const __m128i *>(maps[high].data())), 1);
+}
+
+__attribute__((target("avx2")))
+std::uint32_t runAvx2(const Map *maps, std::uint32_t state,
+                      const unsigned char *data, std::size_t length) {
+    constexpr std::size_t SEGMENTS = 8;
+    const std::size_t segment = length / SEGMENTS;
+    const unsigned char *p[SEGMENTS];
+    for (std::size_t k = 0; k < SEGMENTS; ++k) p[k] = data + k * segment;
+
+    const __m256i identity = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                              8, 9, 10, 11, 12, 13, 14, 15,
+                                              0, 1, 2, 3, 4, 5, 6, 7,
+                                              8, 9, 10, 11, 12, 13, 14, 15);
+    __m256i m01 = identity, m23 = identity, m45 = identity, m67 = identity;
+    for (std::size_t i = 0; i < segment; ++i) {
+        m01 = _mm256_shuffle_epi8(loadPair(maps, p[0][i], p[1][i]), m01);
+        m23 = _mm256_shuffle_epi8(loadPair(maps, p[2][i], p[3][i]), m23);
+        m45 = _mm256_shuffle_epi8(loadPair(maps, p[4][i], p[5][i]), m45);
+        m67 = _mm256_shuffle_epi8(loadPair(maps, p[6][i], p[7][i]), m67);
+    }
+
+    alignas(32) std::uint8_t out[SEGMENTS][16];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(out[0]), m01);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(out[2]), m23);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(out[4]), m45);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(out[6]), m67);
+    for (std::size_t k = 0; k < SEGMENTS; ++k) state = out[k][state];
+
+    const std::size_t done = SEGMENTS * segment;
+    return runScalar(maps, state, data + done, length - done);
+}
+
+#endif // ZFLAP_SHUFFLE_X86
+
+#if defined(ZFLAP_SHUFFLE_NEON)
+
+// Same scheme as runSse42, with TBL as the shuffle
+std::uint32_t runNeon(const Map *maps, std::uint32_t state,
+                      const unsigned char *data, std::size_t length) {
+    constexpr std::size_t SEGMENTS = 4;
+    const std::size_t segment = length / SEGMENTS;
+    const unsigned char *p0 = data;
+    const unsigned char *p1 = p0 + segment;
+    const unsigned char *p2 = p1 + segment;
+    const unsigned char *p3 = p2 + segment;
+
+    static const std::uint8_t lanes[16] = {0, 1, 2, 3, 4, 5, 6, 7,
+                                           8, 9, 10, 11, 12, 13, 14, 15};
+    const uint8x16_t identity = vld1q_u8(lanes);
+    uint8x16_t m0 = identity, m1 = identity, m2 = identity, m3 = identity;
+    for (std::size_t i = 0; i < segment; ++i) {
+        m0 = vqtbl1q_u8(vld1q_u8(maps[p0[i]].data()), m0);
+        m1 = vqtbl1q_u8(vld1q_u8(maps[p1[i]].data()), m1);
+        m2 = vqtbl1q_u8(vld1q_u8(maps[p2[i]].data()), m2);
+        m3 = vqtbl1q_u8(vld1q_u8(maps[p3[i]].data()), m3);
+    }
+
+    std::uint8_t out[SEGMENTS][16];
+    vst1q_u8(out[0], m0);
+    vst1q_u8(out[1], m1);
+    vst1q_u8(out[2], m2);
+    vst1q_u8(out[3], m3);
+    for (std::size_t k = 0; k < SEGMENTS; ++k) state = out[k][state];
+
+    const std::size_t done = SEGMENTS * segment;
+    return runScalar(maps, state, data + done, length - done);
+}
+
+#endif // ZFLAP_SHUFFLE_NEON
+
+} // namespace
+
+bool ShuffleDFA::fits(const CompiledDFA &dfa) {
+    return dfa.getStateCount() <= MAX_STATES;
+}
+
+bool ShuffleDFA::isSupported(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::Scalar:
+            return true;
+#if defined(ZFLAP_SHUFFLE_X86)
+        case Kernel::Sse42:
+            return __builtin_cpu_supports("sse4.2");
+        case Kernel::Avx2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#if defined(ZFLAP_SHUFFLE_NEON)
+        case Kernel::Neon:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+ShuffleDFA::Kernel ShuffleDFA::bestKernel() {
+    // Probing the CPU is cheap but not free, so do it once per process
+    static const Kernel best = [] {
+        for (Kernel k : {Kernel::Avx2, Kernel::Sse42, Kernel::Neon}) {
+            if (isSupported(k)) return k;
+        }
+        return Kernel::Scalar;
+    }();
+    return best;
+}
+
+const char *ShuffleDFA::kernelName(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::Sse42: return "sse4.2";
+        case Kernel::Avx2: return "avx2";
+        case Kernel::Neon: return "neon";
+        case Kernel::Scalar:
+        default: return "scalar";
+    }
+}
+
+ShuffleDFA::ShuffleDFA(const CompiledDFA &dfa, Kernel kernel) : kernel(kernel) {
+    if (!fits(dfa)) {
+        throw std::invalid_argument("ShuffleDFA: " + std::to_string(dfa.getStateCount()) +
+                                    " states do not fit in " + std::to_string(MAX_STATES) +
+                                    " lanes");
+    }
+    if (!isSupported(kernel)) {
+        throw std::invalid_argument(std::string("ShuffleDFA: kernel '") + kernelName(kernel) +
+                                    "' is not supported by this CPU");
+    }
+
+    // Lanes past the last row are never read back; they stay at the dead state
+    const std::uint32_t states = dfa.getStateCount();
+    for (unsigned byte = 0; byte < 256; ++byte) {
+        for (std::uint32_t s = 0; s < states; ++s) {
+            maps[byte][s] = static_cast<std::uint8_t>(dfa.next(s, static_cast<unsigned char>(byte)));
+        }
+    }
+}
+
+std::uint32_t ShuffleDFA::run(std::uint32_t state, const char *data, std::size_t length) const {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+    if (length < MIN_VECTOR_LENGTH) return runScalar(maps.data(), state, bytes, length);
+    switch (kernel) {
+#if defined(ZFLAP_SHUFFLE_X86)
+        case Kernel::Sse42:
+            return runSse42(maps.data(), state, bytes, length);
+        case Kernel::Avx2:
+            return runAvx2(maps.data(), state, bytes, length);
+#endif
+#if defined(ZFLAP_SHUFFLE_NEON)
+        case Kernel::Neon:
+            return runNeon(maps.data(), state, bytes, length);
+#endif
+        case Kernel::Scalar:
+        default:
+            return runScalar(maps.data(), state, bytes, length);
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file ShuffleDFA.h
+ * @brief Byte-shuffle execution kernel for deterministic automata with at most 16 states
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef SHUFFLEDFA_H
+#define SHUFFLEDFA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class CompiledDFA;
+
+/**
+ * @brief Runs a small CompiledDFA with vector byte shuffles instead of table loads
+ *
+ * When a DFA has at most 16 rows, the transition on one input byte is a map
+ * from 16 states to 16 states and fits in a single 16-byte vector:
+ * lane s holds the row reached from row s. Composing two such maps is one
+ * byte shuffle (PSHUFB on x86, TBL on ARM), so the kernel tracks the map of a
+ * whole input segment, starting from the identity, without knowing which state
+ * the segment starts in.
+ *
+ * The input is split into independent segments whose maps are built in
+ * lockstep, so the shuffles form several short dependency chains instead of
+ * the single load-to-load chain of the table walk. The segment maps are then
+ * composed in order and applied to the starting row.
+ *
+ * The kernel is picked at runtime from the instruction sets of the CPU
+ * (AVX2, SSE4.2, NEON or a portable scalar loop). Inputs shorter than
+ * MIN_VECTOR_LENGTH always take the scalar loop, which still beats the
+ * CompiledDFA table walk because the maps are indexed by the raw byte.
+ *
+ * Rows are numbered exactly as in the CompiledDFA the kernel was built from.
+ * Immutable after construction and safe to share between threads.
+ */
+class ShuffleDFA {
+public:
+    static constexpr std::uint32_t MAX_STATES = 16;      ///< Rows that fit in one 16-byte vector
+    static constexpr std::size_t MIN_VECTOR_LENGTH = 32; ///< Shorter inputs use the scalar loop
+
+    /// Execution kernels, from the most portable to the widest.
+    enum class Kernel {
+        Scalar, ///< One byte-indexed lookup per input byte
+        Sse42,  ///< 128-bit PSHUFB over 4 segments
+        Avx2,   ///< 256-bit VPSHUFB over 8 segments, two per register
+        Neon    ///< 128-bit TBL over 4 segments
+    };
+
+    /**
+     * @brief Check whether a compiled automaton is small enough for this kernel
+     * @return true if the automaton has at most MAX_STATES rows, dead state included
+     */
+    static bool fits(const CompiledDFA &dfa);
+
+    /// Whether the running CPU can execute the given kernel.
+    static bool isSupported(Kernel kernel);
+
+    /// The widest kernel the running CPU supports.
+    static Kernel bestKernel();
+
+    /// Human readable name of a kernel, for logs and benchmark labels.
+    static const char *kernelName(Kernel kernel);
+
+    /**
+     * @brief Build the shuffle tables of a compiled automaton
+     * @param dfa The automaton; it must satisfy fits()
+     * @param kernel The kernel used by run()
+     * @throws std::invalid_argument If the automaton has more than MAX_STATES rows
+     *         or the kernel is not supported by this CPU
+     */
+    explicit ShuffleDFA(const CompiledDFA &dfa, Kernel kernel = bestKernel());
+
+    /**
+     * @brief Follow a whole byte range from the given state
+     * @param state Row of the CompiledDFA the kernel was built from
+     * @return The row reached after the last byte
+     */
+    std::uint32_t run(std::uint32_t state, const char *data, std::size_t length) const;
+
+    /// The kernel used by run().
+    Kernel getKernel() const { return kernel; }
+
+private:
+    using Map = std::array<std::uint8_t, MAX_STATES>;
+
+    alignas(32) std::array<Map, 256> maps{}; ///< Input byte -> next row of every row
+    Kernel kernel = Kernel::Scalar;          ///< Kernel used by run()
+};
+
+#endif // SHUFFLEDFA_H
@@ -0,0 +1,123 @@
+/**
+ * @file StateBitset.h
+ * @brief Dense bitset over interned state ids
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef STATEBITSET_H
+#define STATEBITSET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Index of the lowest set bit of a non-zero word
+ */
+inline unsigned lowestSetBit(std::uint64_t word) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+}
+
+/**
+ * @brief Set of states stored as one bit per StateId in 64-bit words
+ *
+ * Used by the simulation engines to represent the current set of active NFA
+ * states. Union is a word-wise OR and iteration skips empty words, so a step
+ * costs O(|Q|/64) plus the work for the states actually set. The size is fixed
+ * at construction, so stepping never allocates.
+ */
+class StateBitset {
+public:
+    StateBitset() = default;
+
+    /// Create an empty set able to hold ids 0..bits-1.
+    explicit StateBitset(std::size_t bits) : bitCount(bits), words((bits + 63) / 64, 0) {}
+
+    /// Number of ids the set can hold.
+    std::size_t size() const { return bitCount; }
+
+    /// Number of 64-bit words of storage.
+    std::size_t wordCount() const { return words.size(); }
+
+    const std::uint64_t *data() const { return words.data(); }
+    std::uint64_t *data() { return words.data(); }
+
+    void set(std::size_t i) { words[i >> 6] |= std::uint64_t(1) << (i & 63); }
+    void reset(std::size_t i) { words[i >> 6] &= ~(std::uint64_t(1) << (i & 63)); }
+    bool test(std::size_t i) const { return (words[i >> 6] >> (i & 63)) & 1u; }
+
+    /// Remove every element.
+    void clear() { std::fill(words.begin(), words.end(), 0); }
+
+    /// Whether at least one id is set.
+    bool any() const {
+        for (std::uint64_t w : words) {
+            if (w) return true;
+        }
+        return false;
+    }
+
+    /// Number of ids set.
+    std::size_t count() const {
+        std::size_t n = 0;
+        for (std::uint64_t w : words) {
+            for (; w; w &= w - 1) ++n;
+        }
+        return n;
+    }
+
+    /// In-place union with a row of the same number of words.
+    void orWith(const std::uint64_t *row) {
+        for (std::size_t i = 0; i < words.size(); ++i) words[i] |= row[i];
+    }
+
+    /// In-place union with another set of the same size.
+    void orWith(const StateBitset &other) { orWith(other.words.data()); }
+
+    /// Whether both sets have an element in common.
+    bool intersects(const StateBitset &other) const {
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            if (words[i] & other.words[i]) return true;
+        }
+        return false;
+    }
+
+    /// Call f(id) for every id in the set, in increasing order.
+    template <typename F>
+    void forEach(F &&f) const {
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            for (std::uint64_t w = words[i]; w; w &= w - 1) {
+                f(static_cast<std::uint32_t>((i << 6) + lowestSetBit(w)));
+            }
+        }
+    }
+
+    void swap(StateBitset &other) {
+        std::swap(bitCount, other.bitCount);
+        words.swap(other.words);
+    }
+
+    bool operator==(const StateBitset &other) const {
+        return bitCount == other.bitCount && words == other.words;
+    }
+    bool operator!=(const StateBitset &other) const { return !(*this == other); }
+
+private:
+    std::size_t bitCount = 0;
+    std::vector<std::uint64_t> words;
+};
+
+#endif // STATEBITSET_H
@@ -0,0 +1,44 @@
+/**
+ * @file StreamMatcher.cpp
+ * @brief Implementation of the StreamMatcher class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "StreamMatcher.h"
+
+namespace {
+
+CompiledDFA compileForStreaming(const Transition &t,
+                                const std::string &initialState,
+                                const std::set<std::string> &finalStates,
+                                std::size_t maxStates) {
+    if (CompiledDFA::isDeterministic(t)) {
+        return CompiledDFA(t, initialState, finalStates);
+    }
+    DeterministicAutomaton d = determinize(t, initialState, finalStates, maxStates);
+    return CompiledDFA(d.delta, d.initialState, d.finalStates);
+}
+
+} // namespace
+
+StreamMatcher::StreamMatcher(const Transition &t,
+                             const std::string &initialState,
+                             const std::set<std::string> &finalStates,
+                             std::size_t maxStates)
+    : dfa(compileForStreaming(t, initialState, finalStates, maxStates)),
+      state(dfa.getInitialState()) {}
+
+void StreamMatcher::feed(const char *data, std::size_t length) {
+    consumed += length;
+    // The dead state only loops to itself
+    if (state == CompiledDFA::DEAD_STATE) return;
+    state = dfa.run(state, data, length);
+}
+
+bool StreamMatcher::finish() {
+    bool accepted = isAccepting();
+    reset();
+    return accepted;
+}
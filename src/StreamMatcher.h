@@ -0,0 +1,84 @@
+/**
+ * @file StreamMatcher.h
+ * @brief Incremental membership test over input delivered in chunks
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef STREAMMATCHER_H
+#define STREAMMATCHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include "CompiledDFA.h"
+#include "Determinization.h"
+#include "Transition.h"
+
+/**
+ * @brief Validates an input stream chunk by chunk in constant memory
+ *
+ * The automaton is determinized (if needed) and compiled once at
+ * construction, so the whole matcher state between chunks is a single table
+ * row. feed() advances it across chunk boundaries, and isAccepting() and
+ * reset() only read or write that row. Once the dead state is reached, later
+ * chunks are skipped without being scanned.
+ *
+ * Typical use: read a file or pipe into a fixed buffer, feed() every chunk,
+ * then call isAccepting().
+ */
+class StreamMatcher {
+public:
+    /**
+     * @brief Compile an automaton for streaming
+     * @param t The transition function (it may be nondeterministic or have ε-moves)
+     * @param initialState The initial state
+     * @param finalStates The set of accepting states
+     * @param maxStates Limit passed to determinize() for nondeterministic input
+     * @throws std::length_error If determinization needs more than maxStates states
+     */
+    StreamMatcher(const Transition &t,
+                  const std::string &initialState,
+                  const std::set<std::string> &finalStates,
+                  std::size_t maxStates = DEFAULT_MAX_DFA_STATES);
+
+    /**
+     * @brief Consume the next chunk of the input
+     * @param data First byte of the chunk
+     * @param length Number of bytes in the chunk (0 is allowed)
+     */
+    void feed(const char *data, std::size_t length);
+
+    /// Whether the input fed so far is accepted. O(1).
+    bool isAccepting() const { return dfa.isAccepting(state); }
+
+    /// Whether no continuation of the input fed so far can be accepted. O(1).
+    bool isDead() const { return state == CompiledDFA::DEAD_STATE; }
+
+    /// Start over with an empty input. O(1).
+    void reset() {
+        state = dfa.getInitialState();
+        consumed = 0;
+    }
+
+    /**
+     * @brief End the current input
+     * @return Whether the whole input was accepted; the matcher is reset afterwards
+     */
+    bool finish();
+
+    /// Number of bytes fed since construction or the last reset().
+    std::uint64_t getConsumed() const { return consumed; }
+
+    /// The compiled automaton driving the matcher.
+    const CompiledDFA &getCompiledDFA() const { return dfa; }
+
+private:
+    CompiledDFA dfa;
+    std::uint32_t state;
+    std::uint64_t consumed = 0;
+};
+
+#endif // STREAMMATCHER_H
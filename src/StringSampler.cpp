@@ -0,0 +1,175 @@
+/**
+ * @file StringSampler.cpp
+ * @brief Implementation of the StringSampler class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "StringSampler.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+/// Uniform integer in [0, bound) by rejection over bound's bit length.
+BigCount randomBelow(const BigCount &bound, std::mt19937_64 &rng) {
+    const std::size_t bits = bound.bitLength();
+    std::vector<std::uint32_t> limbs(bound.limbCount());
+    const std::uint32_t topMask = bits % 32 ? (std::uint32_t(1) << (bits % 32)) - 1 : 0xFFFFFFFFu;
+    for (;;) {
+        for (std::uint32_t &limb : limbs) limb = static_cast<std::uint32_t>(rng());
+        limbs.back() &= topMask;
+        BigCount candidate = BigCount::fromLimbs(limbs);
+        if (candidate < bound) return candidate; // accepted with probability > 1/2
+    }
+}
+
+} // namespace
+
+StringSampler::StringSampler(const CompiledDFA &dfa, std::size_t length, std::size_t maxBytes)
+    : length(length), one(1) {
+    const std::uint32_t rows = dfa.getStateCount();
+
+    // Targets of every row, skipping the bytes without transitions
+    std::vector<std::vector<std::uint32_t>> successors(rows), predecessors(rows);
+    for (std::uint32_t p = 0; p < rows; ++p) {
+        for (int b = 0; b < 256; ++b) {
+            if (dfa.getByteClass(static_cast<unsigned char>(b)) == 0) continue;
+            std::uint32_t q = dfa.next(p, static_cast<unsigned char>(b));
+            if (q == CompiledDFA::DEAD_STATE) continue;
+            if (successors[p].empty() || successors[p].back() != q) successors[p].push_back(q);
+        }
+        std::sort(successors[p].begin(), successors[p].end());
+        successors[p].erase(std::unique(successors[p].begin(), successors[p].end()), successors[p].end());
+        for (std::uint32_t q : successors[p]) predecessors[q].push_back(p);
+    }
+
+    // Rows that lie on some path from the initial row to an accepting row
+    auto mark = [rows](const std::vector<std::vector<std::uint32_t>> &edges,
+                       std::vector<std::uint32_t> pending) {
+        std::vector<bool> seen(rows, false);
+        for (std::uint32_t p : pending) seen[p] = true;
+        while (!pending.empty()) {
+            std::uint32_t p = pending.back();
+            pending.pop_back();
+            for (std::uint32_t q : edges[p]) {
+                if (!seen[q]) {
+                    seen[q] = true;
+                    pending.push_back(q);
+                }
+            }
+        }
+        return seen;
+    };
+    std::vector<std::uint32_t> finals;
+    for (std::uint32_t p = 0; p < rows; ++p) {
+        if (dfa.isAccepting(p)) finals.push_back(p);
+    }
+    const std::vector<bool> reachable = mark(successors, {dfa.getInitialState()});
+    const std::vector<bool> live = mark(predecessors, finals);
+
+    std::vector<std::uint32_t> compact(rows, UINT32_MAX);
+    std::vector<std::uint32_t> original;
+    for (std::uint32_t p = 0; p < rows; ++p) {
+        if (p != CompiledDFA::DEAD_STATE && reachable[p] && live[p]) {
+            compact[p] = static_cast<std::uint32_t>(original.size());
+            original.push_back(p);
+        }
+    }
+    if (compact[dfa.getInitialState()] == UINT32_MAX) {
+        moveStart.assign(1, 0);
+        return; // no accepted string at all
+    }
+    initial = compact[dfa.getInitialState()];
+
+    // One move per (row, target row), holding every byte between them
+    moveStart.reserve(original.size() + 1);
+    for (std::uint32_t p : original) {
+        moveStart.push_back(static_cast<std::uint32_t>(moves.size()));
+        accepting.push_back(dfa.isAccepting(p));
+        for (std::uint32_t q : successors[p]) {
+            if (compact[q] == UINT32_MAX) continue;
+            Move move{compact[q], static_cast<std::uint32_t>(bytes.size()), 0};
+            for (int b = 0; b < 256; ++b) {
+                unsigned char byte = static_cast<unsigned char>(b);
+                if (dfa.getByteClass(byte) != 0 && dfa.next(p, byte) == q) {
+                    bytes.push_back(static_cast<char>(b));
+                    ++move.byteCount;
+                }
+            }
+            moves.push_back(move);
+        }
+    }
+    moveStart.push_back(static_cast<std::uint32_t>(moves.size()));
+
+    // Check the budget before committing to the table: per layer one BigCount
+    // per move, with at most k · log2(widest row) bits each
+    std::uint32_t widest = 1;
+    for (std::uint32_t p = 0; p + 1 < moveStart.size(); ++p) {
+        std::uint32_t width = 0;
+        for (std::uint32_t m = moveStart[p]; m < moveStart[p + 1]; ++m) width += moves[m].byteCount;
+        widest = std::max(widest, width);
+    }
+    const double bitsPerStep = std::log2(static_cast<double>(widest));
+    double estimate = 0;
+    for (std::size_t k = 1; k <= length; ++k) {
+        double limbs = std::floor((static_cast<double>(k) * bitsPerStep + 1) / 32) + 1;
+        estimate += static_cast<double>(moves.size()) * (sizeof(BigCount) + limbs * sizeof(std::uint32_t));
+    }
+    if (estimate > static_cast<double>(maxBytes)) {
+        throw std::length_error("StringSampler: counting strings of length " + std::to_string(length) +
+                                " needs about " + std::to_string(static_cast<std::size_t>(estimate) >> 20) +
+                                " MB, over the limit of " + std::to_string(maxBytes >> 20) + " MB");
+    }
+
+    // prefix[k][m] = prefix[k][m - 1] + byteCount(m) · completions[k - 1][target(m)]
+    prefixes.resize(length * moves.size());
+    tableBytes = prefixes.size() * sizeof(BigCount);
+    for (std::size_t k = 1; k <= length; ++k) {
+        BigCount *layer = &prefixes[(k - 1) * moves.size()];
+        for (std::uint32_t p = 0; p + 1 < moveStart.size(); ++p) {
+            for (std::uint32_t m = moveStart[p]; m < moveStart[p + 1]; ++m) {
+                if (m > moveStart[p]) layer[m] = layer[m - 1];
+                layer[m].addProduct(completions(k - 1, moves[m].target), moves[m].byteCount);
+                tableBytes += layer[m].limbCount() * sizeof(std::uint32_t);
+            }
+        }
+    }
+    total = completions(length, initial);
+}
+
+const BigCount &StringSampler::completions(std::size_t k, std::uint32_t p) const {
+    if (k == 0) return accepting[p] ? one : zero;
+    if (moveStart[p] == moveStart[p + 1]) return zero;
+    return prefix(k, moveStart[p + 1] - 1);
+}
+
+std::string StringSampler::sample(std::mt19937_64 &rng) const {
+    if (empty()) {
+        throw std::logic_error("StringSampler: no accepted string of length " + std::to_string(length));
+    }
+
+    // The moves split [0, completions) into consecutive blocks, and the block
+    // of a move splits again into byteCount · completions of its target. Taking
+    // the rank modulo byteCount picks the byte and the quotient is a uniform
+    // rank among the completions of the target, so one draw serves the walk.
+    BigCount rank = randomBelow(total, rng);
+    std::string out;
+    out.reserve(length);
+    std::uint32_t state = initial;
+    for (std::size_t k = length; k > 0; --k) {
+        // Empty blocks (moves with no completion of this length) are never chosen
+        const BigCount *first = &prefix(k, moveStart[state]);
+        const BigCount *last = first + (moveStart[state + 1] - moveStart[state]);
+        const BigCount *block = std::upper_bound(first, last, rank);
+        if (block != first) rank -= block[-1];
+        const Move &move = moves[moveStart[state] + static_cast<std::uint32_t>(block - first)];
+
+        std::uint32_t byte = move.byteCount == 1 ? 0 : rank.divideSmall(move.byteCount);
+        out.push_back(bytes[move.firstByte + byte]);
+        state = move.target;
+    }
+    return out;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file StringSampler.h
+ * @brief Uniform random sampling of accepted strings of a fixed length
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef STRINGSAMPLER_H
+#define STRINGSAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "BigCount.h"
+#include "CompiledDFA.h"
+
+/**
+ * @brief Draws accepted strings of one length, each with the same probability
+ *
+ * Only rows that are reachable from the initial state and can still reach an
+ * accepting one are kept. The bytes of a row are grouped into one move per
+ * target row, weighted by how many bytes lead there. Construction counts, for
+ * every k <= length, the accepted strings of length k through each move and
+ * stores them as running prefix sums over the moves of the row.
+ *
+ * A sample picks a rank below the total and walks from the initial state. At
+ * each step a binary search over the prefix sums finds the move whose block
+ * holds the rank, and the remainder of the rank inside that block picks the
+ * byte and the rank among the completions of the target. Every accepted string
+ * corresponds to exactly one rank, so the distribution is exactly uniform.
+ *
+ * A step costs O(log d) big-integer comparisons, where d is the number of moves
+ * of the row (at most the number of rows), plus one subtraction and one
+ * division by a byte count. Comparisons of a rank against the prefix sums
+ * usually stop at the top limb; the subtraction and division are linear in the
+ * O(k · log2|Σ|) bits of the counts, so a sample is O(length · log d)
+ * big-integer operations and O(length² · log2|Σ| / 32) word operations in the
+ * worst case. The table holds one count per (k, move) instead of per (k, row),
+ * and construction throws before it would outgrow the given memory budget.
+ *
+ * The sampler is immutable after construction; each thread needs its own
+ * random engine.
+ */
+class StringSampler {
+public:
+    static constexpr std::size_t DEFAULT_MAX_BYTES = std::size_t(256) << 20; ///< Default table budget
+
+    /**
+     * @brief Precompute the completion counts of a DFA
+     * @param dfa The automaton to sample; it is not referenced after construction
+     * @param length Length of the strings to draw
+     * @param maxBytes Memory budget for the count table
+     * @throws std::length_error If the count table would need more than maxBytes
+     */
+    StringSampler(const CompiledDFA &dfa, std::size_t length, std::size_t maxBytes = DEFAULT_MAX_BYTES);
+
+    /// Number of accepted strings of the sampled length.
+    const BigCount &getCount() const { return total; }
+
+    /// Whether there is no accepted string of the sampled length.
+    bool empty() const { return total.isZero(); }
+
+    /// Approximate memory used by the count table, in bytes.
+    std::size_t getTableBytes() const { return tableBytes; }
+
+    /**
+     * @brief Draw one accepted string uniformly at random
+     * @param rng Random engine
+     * @return An accepted string of the sampled length
+     * @throws std::logic_error If no string of that length is accepted
+     */
+    std::string sample(std::mt19937_64 &rng) const;
+
+private:
+    /// Every byte from one row into the same target row.
+    struct Move {
+        std::uint32_t target;    ///< Compact id of the target row
+        std::uint32_t firstByte; ///< Bytes are bytes[firstByte .. firstByte + byteCount)
+        std::uint32_t byteCount; ///< Weight of the move
+    };
+
+    /// Strings of length k through moves[moveStart[p] .. m] of their row, for k >= 1.
+    const BigCount &prefix(std::size_t k, std::uint32_t m) const {
+        return prefixes[(k - 1) * moves.size() + m];
+    }
+
+    /// Accepted strings of length k starting at compact row p.
+    const BigCount &completions(std::size_t k, std::uint32_t p) const;
+
+    std::size_t length;
+    std::uint32_t initial = 0; ///< Compact id of the initial row (valid only if !empty())
+    std::vector<bool> accepting;
+    std::vector<std::uint32_t> moveStart; ///< Moves of row p are moves[moveStart[p] .. moveStart[p + 1])
+    std::vector<Move> moves;
+    std::vector<char> bytes;
+    std::vector<BigCount> prefixes; ///< [k - 1][m] -> running sum over the moves of the row
+    BigCount total;
+    BigCount zero, one;
+    std::size_t tableBytes = 0;
+};
+
+#endif // STRINGSAMPLER_H
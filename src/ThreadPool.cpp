@@ -0,0 +1,87 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the ThreadPool class
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1; // hardware_concurrency() may be unknown
+
+    // The caller of parallelFor() is one of the threads
+    workers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &worker : workers) worker.join();
+}
+
+ThreadPool &ThreadPool::global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)> &fn) {
+    if (count == 0) return;
+
+    std::lock_guard<std::mutex> call(callMutex);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &fn;
+        taskCount = count;
+        nextIndex.store(0, std::memory_order_relaxed);
+        busyWorkers = workers.size();
+        failure = nullptr;
+        ++generation;
+    }
+    wake.notify_all();
+
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return busyWorkers == 0; });
+    task = nullptr;
+    if (failure) std::rethrow_exception(failure);
+}
+
+void ThreadPool::runTasks() {
+    for (;;) {
+        std::size_t i = nextIndex.fetch_add(1, std::memory_order_relaxed);
+        if (i >= taskCount) return;
+        try {
+            (*task)(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure) failure = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+
+        runTasks();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busyWorkers == 0) done.notify_one();
+    }
+}
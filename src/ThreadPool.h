@@ -0,0 +1,81 @@
+/**
+ * @file ThreadPool.h
+ * @brief Fixed-size pool of worker threads for data-parallel loops
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A set of long-lived worker threads that run parallel loops
+ *
+ * parallelFor() hands out the indices 0..count-1 to the workers and to the
+ * calling thread through one atomic counter, and returns once every index has
+ * been processed. Threads are created once, so a loop costs a wake-up rather
+ * than a thread start.
+ *
+ * Calls to parallelFor() on the same pool are serialized; a task must not call
+ * parallelFor() on the pool that is running it.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Start the worker threads
+     * @param threads Total number of threads that run tasks, counting the
+     *        caller of parallelFor(). 0 means std::thread::hardware_concurrency().
+     */
+    explicit ThreadPool(unsigned threads = 0);
+
+    /// Stop and join every worker.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// Number of threads that run tasks, including the caller of parallelFor().
+    unsigned getThreadCount() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    /**
+     * @brief Run task(i) for every i in [0, count), in parallel
+     *
+     * Blocks until every call has returned. If a task throws, the remaining
+     * indices are still processed and the first exception is rethrown here.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)> &task);
+
+    /// Process-wide pool with one thread per hardware thread, created on first use.
+    static ThreadPool &global();
+
+private:
+    void workerLoop();
+    void runTasks();
+
+    std::vector<std::thread> workers;
+    std::mutex callMutex; ///< Serializes parallelFor() calls
+    std::mutex mutex;     ///< Guards the job fields below
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    const std::function<void(std::size_t)> *task = nullptr;
+    std::size_t taskCount = 0;
+    std::atomic<std::size_t> nextIndex{0};
+    std::size_t busyWorkers = 0;   ///< Workers that have not finished the current job
+    std::uint64_t generation = 0;  ///< Incremented for every job
+    std::exception_ptr failure;
+    bool stopping = false;
+};
+
+#endif // THREADPOOL_H
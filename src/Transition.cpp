@@ -7,27 +7,218 @@
  */
 
 #include "Transition.h"
+#include "StateBitset.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr std::uint8_t EMPTY_SLOT = 0x80; ///< Control byte of an empty slot; used slots hold a 7-bit tag
+constexpr std::uint64_t LOW_BITS = 0x0101010101010101ull;
+constexpr std::uint64_t HIGH_BITS = 0x8080808080808080ull;
+
+/// Read a group of eight control bytes as one word, byte k in bits 8k..8k+7.
+inline std::uint64_t loadGroup(const std::uint8_t *p) {
+    std::uint64_t group;
+    std::memcpy(&group, p, sizeof group);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    group = __builtin_bswap64(group);
+#endif
+    return group;
+}
+
+/// Byte position of the lowest flagged byte of a group mask.
+inline std::size_t firstByte(std::uint64_t mask) {
+    return lowestSetBit(mask) >> 3;
+}
+
+/// Tag stored in the control byte of a key with this hash.
+inline std::uint8_t tagOf(std::size_t hash) {
+    return static_cast<std::uint8_t>(hash & 0x7f);
+}
+
+} // namespace
 
 void Transition::addTransition(const std::string &from, char symbol, const std::string &to) {
-    // Add the destination state to the vector of destinations for this state-symbol pair
-    // If the key doesn't exist, it will be created automatically
-    delta[{from, symbol}].push_back(to);
+    // Intern both endpoints and delegate to the id-based overload
+    StateId fromId = internState(from);
+    StateId toId = internState(to);
+    addTransition(fromId, symbol, toId);
+}
+
+void Transition::addTransition(StateId from, char symbol, StateId to) {
+    if (symbol == EPSILON) epsilonMoves = true;
+
+    // Keep the load factor at or below 1/2 so probe sequences stay short
+    if ((used + 1) * 2 > slots.size()) grow();
+
+    const TransKey key{from, symbol};
+    const std::size_t index = findSlot(key);
+    Slot &slot = slots[index];
+    if (slot.key.state == INVALID_STATE) {
+        // New state-symbol pair: its run starts at the end of the pool
+        setControl(index, tagOf(KeyHash()(key)));
+        slot.key = key;
+        slot.offset = static_cast<std::uint32_t>(targets.size());
+        slot.count = 1;
+        slot.capacity = 1;
+        targets.push_back(to);
+        ++used;
+        return;
+    }
+
+    if (slot.count == slot.capacity) {
+        // Run is full: move it to the end of the pool with twice the room
+        std::uint32_t offset = static_cast<std::uint32_t>(targets.size());
+        targets.resize(targets.size() + 2 * static_cast<std::size_t>(slot.capacity));
+        std::copy(targets.begin() + slot.offset, targets.begin() + slot.offset + slot.count,
+                  targets.begin() + offset);
+        slot.offset = offset;
+        slot.capacity *= 2;
+    }
+    targets[slot.offset + slot.count++] = to;
+}
+
+std::size_t Transition::findSlot(const TransKey &key) const {
+    const std::size_t mask = slots.size() - 1;
+    const std::size_t hash = KeyHash()(key);
+    const std::uint64_t tag = LOW_BITS * tagOf(hash);
+    std::size_t i = (hash >> 7) & mask;
+
+    for (;;) {
+        // Flag the bytes of the group equal to the tag (rare false positives
+        // are filtered by the key comparison), then look for an empty byte
+        const std::uint64_t group = loadGroup(control.data() + i);
+        const std::uint64_t x = group ^ tag;
+        for (std::uint64_t match = (x - LOW_BITS) & ~x & HIGH_BITS; match; match &= match - 1) {
+            std::size_t j = (i + firstByte(match)) & mask;
+            if (slots[j].key == key) return j;
+        }
+        if (std::uint64_t empty = group & HIGH_BITS) {
+            return (i + firstByte(empty)) & mask;
+        }
+        i = (i + GROUP_SIZE) & mask;
+    }
+}
+
+void Transition::setControl(std::size_t index, std::uint8_t value) {
+    control[index] = value;
+    // The first group is mirrored after the end so groups never wrap
+    if (index < GROUP_SIZE) control[slots.size() + index] = value;
+}
+
+void Transition::grow() {
+    std::vector<Slot> old(std::max<std::size_t>(16, slots.size() * 2),
+                          Slot{{INVALID_STATE, 0}, 0, 0, 0});
+    old.swap(slots);
+    control.assign(slots.size() + GROUP_SIZE, EMPTY_SLOT);
+
+    // Reinsert every entry and lay the runs out contiguously again,
+    // dropping the gaps left behind by relocated runs
+    std::vector<StateId> pool;
+    pool.reserve(targets.size());
+    for (const Slot &entry : old) {
+        if (entry.key.state == INVALID_STATE) continue;
+        std::size_t index = findSlot(entry.key);
+        setControl(index, tagOf(KeyHash()(entry.key)));
+        Slot &slot = slots[index];
+        slot = entry;
+        slot.offset = static_cast<std::uint32_t>(pool.size());
+        slot.capacity = entry.count;
+        pool.insert(pool.end(), targets.begin() + entry.offset,
+                    targets.begin() + entry.offset + entry.count);
+    }
+    targets.swap(pool);
 }
 
 void Transition::clear() {
-    delta.clear();
+    slots.clear();
+    control.clear();
+    targets.clear();
+    used = 0;
+    stateIds.clear();
+    stateNames.clear();
+    epsilonMoves = false;
 }
 
-std::vector<std::string> Transition::       getNextStates(const std::string &from, char symbol) const {
-    // Look up the transition in the hash map
-    auto it = delta.find({from, symbol});
-    
-    // If transition exists, return the vector of destination states
-    if (it != delta.end()) {
-        return it->second;
+std::vector<std::string> Transition::getNextStates(const std::string &from, char symbol) const {
+    // Unknown states have no outgoing transitions
+    StateId fromId = getStateId(from);
+    if (fromId == INVALID_STATE) {
+        return {};
+    }
+
+    // Translate the stored ids back to names
+    StateSpan ids = getNextStates(fromId, symbol);
+    std::vector<std::string> names;
+    names.reserve(ids.size());
+    for (StateId id : ids) {
+        names.push_back(stateNames[id]);
+    }
+    return names;
+}
+
+StateSpan Transition::getNextStates(StateId from, char symbol) const {
+    if (slots.empty()) {
+        return {};
+    }
+
+    // Probe the table for the transition
+    const Slot &slot = slots[findSlot({from, symbol})];
+
+    // If transition exists, view its run of destination states
+    if (slot.key.state != INVALID_STATE) {
+        return {targets.data() + slot.offset, slot.count};
     }
     
-    // If no transition exists, return empty vector
+    // If no transition exists, return an empty view
     return {};
 }
 
+StateSpan Transition::getNextStateIds(const std::string &from, char symbol) const {
+    StateId fromId = getStateId(from);
+    if (fromId == INVALID_STATE) {
+        return {};
+    }
+    return getNextStates(fromId, symbol);
+}
+
+StateId Transition::internState(const std::string &name) {
+    auto it = stateIds.find(name);
+    if (it != stateIds.end()) {
+        return it->second;
+    }
+
+    StateId id = static_cast<StateId>(stateNames.size());
+    stateIds.emplace(name, id);
+    stateNames.push_back(name);
+    return id;
+}
+
+StateId Transition::getStateId(const std::string &name) const {
+    auto it = stateIds.find(name);
+    return it != stateIds.end() ? it->second : INVALID_STATE;
+}
+
+const std::string &Transition::getStateName(StateId id) const {
+    return stateNames[id];
+}
+
+size_t Transition::getStateCount() const {
+    return stateNames.size();
+}
+
+std::vector<char> Transition::getSymbols() const {
+    bool present[256] = {};
+    for (const Slot &slot : slots) {
+        if (slot.key.state != INVALID_STATE) {
+            present[static_cast<unsigned char>(slot.key.symbol)] = true;
+        }
+    }
+
+    std::vector<char> symbols;
+    for (int c = 0; c < 256; ++c) {
+        if (present[c]) symbols.push_back(static_cast<char>(c));
+    }
+    return symbols;
+}
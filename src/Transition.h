@@ -9,10 +9,40 @@
 #ifndef TRANSITION_H
 #define TRANSITION_H
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+/**
+ * @brief Dense integer identifier of an interned state
+ *
+ * Ids are assigned in insertion order starting at 0, so they can be used
+ * directly as indices into per-state arrays.
+ */
+using StateId = std::uint32_t;
+
+/**
+ * @brief Read-only view of the destination ids stored for one (state, symbol) pair
+ *
+ * A StateSpan points into the storage of a Transition, so obtaining one never
+ * allocates. It is invalidated by any later addTransition() or clear() on the
+ * Transition it came from.
+ */
+struct StateSpan {
+    const StateId *first = nullptr; ///< First destination id
+    std::size_t count = 0;          ///< Number of destination ids
+
+    const StateId *begin() const { return first; }
+    const StateId *end() const { return first + count; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    StateId front() const { return first[0]; }
+    StateId operator[](std::size_t i) const { return first[i]; }
+};
+
 /**
  * @brief Structure representing a transition key for finite automaton
  * 
@@ -20,7 +50,7 @@
  * for looking up transitions in the transition function delta.
  */
 struct TransKey {
-    std::string state;  ///< The source state of the transition
+    StateId state;      ///< The interned id of the source state of the transition
     char symbol;        ///< The input symbol that triggers the transition
     
     /**
@@ -34,10 +64,12 @@ struct TransKey {
 };
 
 /**
- * @brief Hash function for TransKey to enable use in unordered_map
+ * @brief Hash function for TransKey
  * 
- * This structure provides a custom hash function for TransKey objects,
- * combining the hash values of the state string and symbol character.
+ * Packs the state id and the symbol into one 64-bit integer and runs it
+ * through the MurmurHash3 finalizer, so that keys differing only in the
+ * symbol or in low id bits land far apart. Transition relies on the low bits
+ * being well mixed because its table is indexed by hash & (capacity - 1).
  */
 struct KeyHash {
     /**
@@ -46,7 +78,14 @@ struct KeyHash {
      * @return A hash value for the given TransKey
      */
     size_t operator()(const TransKey &k) const {
-        return std::hash<std::string>()(k.state) ^ std::hash<char>()(k.symbol);
+        std::uint64_t x = (static_cast<std::uint64_t>(k.state) << 8) |
+                          static_cast<unsigned char>(k.symbol);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return static_cast<size_t>(x);
     }
 };
 
@@ -56,15 +95,66 @@ struct KeyHash {
  * The Transition class implements a transition function delta that maps
  * (state, symbol) pairs to sets of destination states. This supports both
  * deterministic finite automata (DFA) and non-deterministic finite automata (NFA).
+ *
+ * State names are interned into dense StateId values the first time they
+ * appear in a transition. The id-based overloads avoid hashing and copying
+ * strings and are meant for the validation hot loops; the string API is a
+ * thin wrapper over them.
+ *
+ * The (state, symbol) -> destinations map is a flat open-addressing table
+ * with linear probing, kept at most half full. Each slot stores its TransKey
+ * inline together with the offset, count and capacity of its destination
+ * run in one shared pool of ids, so a lookup touches one contiguous array
+ * and the destinations it returns are contiguous as well. A parallel array
+ * of one control byte per slot (empty, or 7 bits of the hash) lets a probe
+ * test GROUP_SIZE slots with a few word operations instead of a branch per
+ * slot.
  * 
  * @note This implementation allows multiple transitions from the same state-symbol pair,
  * making it suitable for NFA representation.
  */
 class Transition {
 private:
-    std::unordered_map<TransKey, std::vector<std::string>, KeyHash> delta; ///< The transition function mapping (state, symbol) -> {destinations}
+    /// One entry of the open-addressing table; key.state == INVALID_STATE marks it empty.
+    struct Slot {
+        TransKey key;           ///< (state, symbol) of this entry
+        std::uint32_t offset;   ///< Start of its destinations in targets
+        std::uint32_t count;    ///< Number of destinations
+        std::uint32_t capacity; ///< Space reserved in targets at offset
+    };
+
+    /// Number of control bytes examined per probe step.
+    static constexpr std::size_t GROUP_SIZE = 8;
+
+    std::vector<Slot> slots;           ///< The transition function (state, symbol) -> {destinations}; size is 0 or a power of two
+    std::vector<std::uint8_t> control; ///< Control byte per slot, plus a mirror of the first GROUP_SIZE
+    std::vector<StateId> targets;      ///< Pool holding the destination runs of every slot
+    std::size_t used = 0;              ///< Number of occupied slots
+    std::unordered_map<std::string, StateId> stateIds; ///< Interning table name -> id
+    std::vector<std::string> stateNames;               ///< Reverse table id -> name
+    bool epsilonMoves = false;                         ///< Whether any EPSILON transition was added
+
+    /// Index of the slot holding key, or of the empty slot where it would go.
+    std::size_t findSlot(const TransKey &key) const;
+
+    /// Write the control byte of a slot, keeping the mirrored group in sync.
+    void setControl(std::size_t index, std::uint8_t value);
+
+    /// Double the table (at least 16 slots) and compact the destination pool.
+    void grow();
 
 public:
+    /// Returned by getStateId() for names that were never interned.
+    static constexpr StateId INVALID_STATE = std::numeric_limits<StateId>::max();
+
+    /// Symbol used for epsilon transitions, which consume no input.
+    static constexpr char EPSILON = '\0';
+
+    /**
+     * @brief Remove every transition and every interned state
+     */
+    void clear();
+
     /**
      * @brief Add a transition to the automaton
      * 
@@ -79,9 +169,15 @@ public:
      * @note If the same transition is added multiple times, it will be stored
      * multiple times in the destination vector.
      */
-    void clear();
-
     void addTransition(const std::string &from, char symbol, const std::string &to);
+
+    /**
+     * @brief Add a transition between two already interned states
+     * @param from Id of the source state, as returned by internState()
+     * @param symbol The input symbol that triggers the transition
+     * @param to Id of the destination state, as returned by internState()
+     */
+    void addTransition(StateId from, char symbol, StateId to);
     
     /**
      * @brief Get all possible next states for a given state-symbol pair
@@ -96,8 +192,83 @@ public:
      * 
      * @note The order of states in the returned vector is not guaranteed to be
      *       consistent across calls, as it depends on the internal hash map ordering.
+     * @note This copies every destination name; loops should prefer
+     *       getNextStateIds(), which does not allocate.
      */
     std::vector<std::string> getNextStates(const std::string &from, char symbol) const;
+
+    /**
+     * @brief Get the ids of all next states for a given state-symbol pair
+     * @param from Id of the source state
+     * @param symbol The input symbol
+     * @return A view of the stored destination ids, empty if no transition exists
+     */
+    StateSpan getNextStates(StateId from, char symbol) const;
+
+    /**
+     * @brief Get the ids of all next states of a named state without copying
+     *
+     * Same as getNextStates(getStateId(from), symbol); names can be recovered
+     * with getStateName(), which returns a reference.
+     *
+     * @param from The source state
+     * @param symbol The input symbol
+     * @return A view of the stored destination ids, empty for unknown states
+     */
+    StateSpan getNextStateIds(const std::string &from, char symbol) const;
+
+    /**
+     * @brief Return the id of a state, interning the name if it is new
+     * @param name The state name
+     * @return The dense id assigned to the name
+     */
+    StateId internState(const std::string &name);
+
+    /**
+     * @brief Look up the id of a state without interning it
+     * @param name The state name
+     * @return The id of the state, or INVALID_STATE if it was never interned
+     */
+    StateId getStateId(const std::string &name) const;
+
+    /**
+     * @brief Get the name of an interned state
+     * @param id A valid state id (less than getStateCount())
+     * @return The name the id was interned from
+     */
+    const std::string &getStateName(StateId id) const;
+
+    /**
+     * @brief Number of interned states; valid ids are 0..getStateCount()-1
+     */
+    size_t getStateCount() const;
+
+    /**
+     * @brief Whether the automaton has at least one EPSILON transition
+     */
+    bool hasEpsilonTransitions() const { return epsilonMoves; }
+
+    /**
+     * @brief Get the distinct symbols used by at least one transition
+     * @return The symbols in ascending order, including '\0' if present
+     */
+    std::vector<char> getSymbols() const;
+
+    /**
+     * @brief Visit every (state, symbol) entry of the transition function
+     *
+     * The callback receives the source id, the symbol and a view of the
+     * destination ids, i.e. f(StateId from, char symbol, StateSpan to).
+     * The visiting order is unspecified.
+     */
+    template <typename F>
+    void forEachTransition(F &&f) const {
+        for (const Slot &slot : slots) {
+            if (slot.key.state == INVALID_STATE) continue;
+            f(slot.key.state, slot.key.symbol,
+              StateSpan{targets.data() + slot.offset, slot.count});
+        }
+    }
 };
 
 #endif
@@ -0,0 +1,75 @@
+/**
+ * @file Trimming.cpp
+ * @brief Implementation of trimAutomaton()
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include "Trimming.h"
+#include <vector>
+
+namespace {
+
+/// Mark every state reachable from the seeds along the given adjacency lists.
+void markReachable(const std::vector<std::vector<StateId>> &adjacency,
+                   std::vector<StateId> pending,
+                   std::vector<char> &seen) {
+    for (StateId s : pending) seen[s] = 1;
+    while (!pending.empty()) {
+        StateId s = pending.back();
+        pending.pop_back();
+        for (StateId next : adjacency[s]) {
+            if (!seen[next]) {
+                seen[next] = 1;
+                pending.push_back(next);
+            }
+        }
+    }
+}
+
+} // namespace
+
+TrimmedAutomaton trimAutomaton(const Transition &t,
+                               const std::string &initialState,
+                               const std::set<std::string> &finalStates) {
+    TrimmedAutomaton result;
+    const std::size_t n = t.getStateCount();
+
+    std::vector<std::vector<StateId>> successors(n), predecessors(n);
+    t.forEachTransition([&](StateId from, char, StateSpan to) {
+        for (StateId dest : to) {
+            successors[from].push_back(dest);
+            predecessors[dest].push_back(from);
+        }
+    });
+
+    std::vector<char> reachable(n, 0);
+    StateId start = t.getStateId(initialState);
+    if (start != Transition::INVALID_STATE) markReachable(successors, {start}, reachable);
+
+    std::vector<StateId> finals;
+    for (const std::string &name : finalStates) {
+        StateId id = t.getStateId(name);
+        if (id != Transition::INVALID_STATE) finals.push_back(id);
+    }
+    std::vector<char> productive(n, 0);
+    markReachable(predecessors, finals, productive);
+
+    std::vector<char> useful(n, 0);
+    for (StateId s = 0; s < n; ++s) {
+        useful[s] = reachable[s] && productive[s];
+        (useful[s] ? result.usefulStates : result.removedStates).insert(t.getStateName(s));
+    }
+    if (start == Transition::INVALID_STATE && finalStates.count(initialState)) {
+        result.usefulStates.insert(initialState);
+    }
+
+    t.forEachTransition([&](StateId from, char symbol, StateSpan to) {
+        if (!useful[from]) return;
+        for (StateId dest : to) {
+            if (useful[dest]) result.delta.addTransition(t.getStateName(from), symbol, t.getStateName(dest));
+        }
+    });
+    return result;
+}
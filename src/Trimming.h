@@ -0,0 +1,48 @@
+/**
+ * @file Trimming.h
+ * @brief Removal of unreachable and dead states
+ * @author ZFlap Project
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef TRIMMING_H
+#define TRIMMING_H
+
+#include <set>
+#include <string>
+#include "Transition.h"
+
+/**
+ * @brief Result of trimAutomaton(): the useful part of an automaton
+ */
+struct TrimmedAutomaton {
+    Transition delta;                     ///< Transitions between useful states only
+    std::set<std::string> usefulStates;   ///< States on some path from the initial state to a final state
+    std::set<std::string> removedStates;  ///< States of the input that were dropped
+};
+
+/**
+ * @brief Keep only the states that can take part in an accepting run
+ *
+ * A state is useful when it is reachable from the initial state and some final
+ * state is reachable from it. Both sets come from a graph search, forward
+ * from the initial state and backward from the final states, over
+ * every transition including epsilon moves, so the pass costs O(|Q| + |δ|).
+ * Removing the other states and their transitions does not change the language,
+ * but lets validation, determinization and generation skip branches that can
+ * never succeed.
+ *
+ * If the language is empty, delta is empty; an initial state that is also final
+ * stays useful even without transitions.
+ *
+ * @param t The transition function
+ * @param initialState The initial state
+ * @param finalStates The set of accepting states
+ * @return The trimmed transitions and which states were kept or removed
+ */
+TrimmedAutomaton trimAutomaton(const Transition &t,
+                               const std::string &initialState,
+                               const std::set<std::string> &finalStates);
+
+#endif // TRIMMING_H
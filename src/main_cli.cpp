@@ -1,9 +1,14 @@
+#include <fstream>
+#include <stdexcept>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 #include "libs/nlohmann/json.hpp"
 #include "Automaton.h"
+#include "StreamMatcher.h"
 #include "Transition.h"
+#include "validacion_cadenas.h"
 
 using json = nlohmann::json;
 
@@ -35,6 +40,40 @@ int main() {
                 automaton.getDelta().addTransition(from, symbol, to);
                 response["status"] = "success";
                 response["message"] = "Transition added";
+            } else if (action == "validate") {
+                // Example: { "action": "validate", "input": "aab" }
+                std::string input = command["input"];
+                response["status"] = "success";
+                response["accepted"] = automaton.validarCadena(input);
+            } else if (action == "validate_stream") {
+                // Example: { "action": "validate_stream", "path": "capture.log" }
+                // The file is read in fixed-size chunks, so memory use does not depend on its size
+                std::string path = command["path"];
+                std::ifstream input(path, std::ios::binary);
+                if (!input) {
+                    throw std::runtime_error("Cannot open " + path);
+                }
+                // Read-only access keeps the ε-closures cached for later validate commands
+                StreamMatcher matcher(std::as_const(automaton).getDelta(), automaton.getEstadoInicial(),
+                                      automaton.getEstadosFinales());
+                std::vector<char> buffer(1 << 16);
+                while (!matcher.isDead() &&
+                       input.read(buffer.data(), static_cast<std::streamsize>(buffer.size())).gcount() > 0) {
+                    matcher.feed(buffer.data(), static_cast<std::size_t>(input.gcount()));
+                }
+                response["status"] = "success";
+                response["accepted"] = matcher.isAccepting();
+                response["bytes_read"] = matcher.getConsumed();
+            } else if (action == "sample_strings") {
+                // Example: { "action": "sample_strings", "length": 12, "count": 5, "seed": 42 }
+                // Every accepted string of that length is equally likely; the seed makes runs reproducible
+                std::size_t length = command["length"];
+                std::size_t count = command.value("count", 1);
+                std::uint64_t seed = command.value("seed", std::uint64_t(0));
+                response["status"] = "success";
+                response["strings"] = muestrearCadenasAceptadas(std::as_const(automaton).getDelta(),
+                                                                automaton.getEstadoInicial(),
+                                                                automaton.getEstadosFinales(), length, count, seed);
             } else {
                 response["status"] = "error";
                 response["message"] = "Unknown action";
@@ -1,62 +1,119 @@
 #include "validacion_cadenas.h"
+#include "Determinization.h"
+#include "EpsilonClosure.h"
+#include "LanguageCounter.h"
+#include "ParallelGeneration.h"
+#include "ShortlexEnumerator.h"
+#include "StringSampler.h"
+#include "StateBitset.h"
+#include "Trimming.h"
+#include <algorithm>
+#include <memory>
 #include <queue>
+#include <random>
+#include <stdexcept>
 #include <map>
 #include <set>
 
 using namespace std;
 
 /**
- * @brief Estructura para rastrear el estado de exploración BFS
+ * @brief Simula el autómata sobre la cadena manteniendo el conjunto de estados activos
+ *
+ * El conjunto se guarda como un bitset sobre los ids internos de Transition y
+ * se avanza un símbolo a la vez; cada estado se procesa a lo más una vez por
+ * posición y no se reserva memoria por símbolo. Las cerraduras épsilon vienen
+ * ya calculadas y se aplican al estado inicial y a cada destino.
+ *
+ * @param t Transiciones del autómata
+ * @param clausura Cerraduras épsilon de t
+ * @param inicial Id del estado inicial
+ * @param cadena Cadena a procesar
+ * @param actuales Recibe los estados activos al terminar la cadena
  */
-struct EstadoExploracion {
-    string estado;
-    int posicion;
+static void simularConjunto(const Transition &t, const EpsilonClosure &clausura, StateId inicial,
+                            const string &cadena, StateBitset &actuales) {
+    if (clausura.getStateCount() < t.getStateCount()) {
+        throw invalid_argument("simularConjunto: las cerraduras no corresponden a las transiciones");
+    }
+    actuales = StateBitset(t.getStateCount());
+    clausura.addClosure(inicial, actuales);
+    StateBitset siguientes(t.getStateCount());
+
+    for (char simbolo : cadena) {
+        siguientes.clear();
+        // Épsilon no es un símbolo de entrada: un '\0' en la cadena no tiene transiciones
+        if (simbolo != Transition::EPSILON) {
+            actuales.forEach([&](StateId estado) {
+                for (StateId destino : t.getNextStates(estado, simbolo)) {
+                    clausura.addClosure(destino, siguientes);
+                }
+            });
+        }
+        actuales.swap(siguientes);
 
-    bool operator<(const EstadoExploracion &other) const {
-        if (estado != other.estado) return estado < other.estado;
-        return posicion < other.posicion;
+        // Si ya no hay estados activos, ningún camino puede continuar
+        if (!actuales.any()) break;
     }
-};
+}
+
+/**
+ * @brief Nombres de los estados en la cerradura épsilon de un estado
+ *
+ * @param t Transiciones del autómata
+ * @param clausura Cerraduras precalculadas de t
+ * @param estado Estado de partida
+ * @return vector<string> El estado y todos los alcanzables por épsilon
+ */
+static vector<string> cerraduraDe(const Transition &t, const EpsilonClosure &clausura,
+                                  const string &estado) {
+    StateId id = t.getStateId(estado);
+    if (clausura.isTrivial() || id == Transition::INVALID_STATE) return {estado};
+
+    StateBitset bits(clausura.getStateCount());
+    clausura.addClosure(id, bits);
+    vector<string> nombres;
+    bits.forEach([&](StateId s) { nombres.push_back(t.getStateName(s)); });
+    return nombres;
+}
+
+/**
+ * @brief Indica si la cerradura épsilon de un estado contiene un estado final
+ */
+static bool cerraduraAcepta(const Transition &t, const EpsilonClosure &clausura,
+                            const string &estado, const set<string> &estadosFinales) {
+    if (clausura.isTrivial()) return estadosFinales.count(estado) > 0;
+    for (const string &s : cerraduraDe(t, clausura, estado)) {
+        if (estadosFinales.count(s) > 0) return true;
+    }
+    return false;
+}
 
 std::set<std::string> validarCadena(const Transition &t,
                                     const std::string &estadoInicial,
                                     const std::string &cadena) {
-    set<string> estadosFinales;
-    set<EstadoExploracion> visitados;
-    queue<EstadoExploracion> cola;
-
-    // Comenzar desde el estado inicial en posición 0
-    cola.push({estadoInicial, 0});
-    visitados.insert({estadoInicial, 0});
-
-    while (!cola.empty()) {
-        EstadoExploracion actual = cola.front();
-        cola.pop();
-
-        // Si ya procesamos toda la cadena, este es un estado final alcanzable
-        if (actual.posicion == cadena.size()) {
-            estadosFinales.insert(actual.estado);
-            continue;
-        }
-
-        // Obtener el símbolo actual
-        char simbolo = cadena[actual.posicion];
-
-        // Obtener todos los posibles estados siguientes
-        vector<string> siguientes = t.getNextStates(actual.estado, simbolo);
+    return validarCadena(t, EpsilonClosure(t), estadoInicial, cadena);
+}
 
-        // Explorar cada transición posible
-        for (const string &siguienteEstado : siguientes) {
-            EstadoExploracion nuevoEstado = {siguienteEstado, actual.posicion + 1};
+std::set<std::string> validarCadena(const Transition &t,
+                                    const EpsilonClosure &clausura,
+                                    const std::string &estadoInicial,
+                                    const std::string &cadena) {
+    set<string> estadosFinales;
 
-            // Solo procesar si no hemos visitado este estado en esta posición
-            if (visitados.find(nuevoEstado) == visitados.end()) {
-                visitados.insert(nuevoEstado);
-                cola.push(nuevoEstado);
-            }
-        }
+    // Un estado inicial sin transiciones sólo puede aceptar la cadena vacía
+    StateId inicial = t.getStateId(estadoInicial);
+    if (inicial == Transition::INVALID_STATE) {
+        if (cadena.empty()) estadosFinales.insert(estadoInicial);
+        return estadosFinales;
     }
 
+    StateBitset alcanzados;
+    simularConjunto(t, clausura, inicial, cadena, alcanzados);
+    alcanzados.forEach([&](StateId estado) {
+        estadosFinales.insert(t.getStateName(estado));
+    });
+
     return estadosFinales;
 }
 
@@ -73,11 +130,36 @@ bool esAceptada(const Transition &t,
                 const string &estadoInicial,
                 const set<string> &estadosFinales,
                 const string &cadena) {
-    set<string> estadosAlcanzados = validarCadena(t, estadoInicial, cadena);
+    return esAceptada(t, EpsilonClosure(t), estadoInicial, estadosFinales, cadena);
+}
+
+/**
+ * @brief Verifica si una cadena es aceptada reutilizando cerraduras precalculadas
+ *
+ * @param t Transiciones del autómata
+ * @param clausura Cerraduras épsilon de t, calculadas una vez por autómata
+ * @param estadoInicial Estado inicial del autómata
+ * @param estadosFinales Conjunto de estados de aceptación
+ * @param cadena Cadena a verificar
+ * @return true si la cadena es aceptada, false en caso contrario
+ */
+bool esAceptada(const Transition &t,
+                const EpsilonClosure &clausura,
+                const string &estadoInicial,
+                const set<string> &estadosFinales,
+                const string &cadena) {
+    StateId inicial = t.getStateId(estadoInicial);
+    if (inicial == Transition::INVALID_STATE) {
+        return cadena.empty() && estadosFinales.count(estadoInicial) > 0;
+    }
+
+    StateBitset alcanzados;
+    simularConjunto(t, clausura, inicial, cadena, alcanzados);
 
     // Verificar si alguno de los estados alcanzados es un estado final
-    for (const string &estado : estadosAlcanzados) {
-        if (estadosFinales.count(estado) > 0) {
+    for (const string &estado : estadosFinales) {
+        StateId id = t.getStateId(estado);
+        if (id != Transition::INVALID_STATE && alcanzados.test(id)) {
             return true;
         }
     }
@@ -86,24 +168,173 @@ bool esAceptada(const Transition &t,
 }
 
 /**
- * @brief Genera todas las cadenas aceptadas hasta una longitud máxima
+ * @brief Verifica si una cadena es aceptada usando un simulador con bitsets precalculados
+ *
+ * @param simulador Simulador construido una sola vez para el autómata
+ * @param cadena Cadena a verificar
+ * @return true si la cadena es aceptada, false en caso contrario
+ */
+bool esAceptada(const NFASimulator &simulador, const string &cadena) {
+    return simulador.accepts(cadena);
+}
+
+/**
+ * @brief Verifica si una cadena es aceptada por un autómata compilado
+ *
+ * @param dfa Autómata determinista compilado
+ * @param cadena Cadena a verificar
+ * @return true si la cadena es aceptada, false en caso contrario
+ */
+bool esAceptada(const CompiledDFA &dfa, const string &cadena) {
+    return dfa.accepts(cadena);
+}
+
+/**
+ * @brief Verifica si una cadena es aceptada por un AFD perezoso
+ *
+ * @param dfa AFD perezoso; su caché de transiciones se actualiza
+ * @param cadena Cadena a verificar
+ * @return true si la cadena es aceptada, false en caso contrario
+ */
+bool esAceptada(LazyDFA &dfa, const string &cadena) {
+    return dfa.accepts(cadena);
+}
+
+/**
+ * @brief Compila el autómata a tabla, determinizándolo si hace falta
+ *
+ * Primero se eliminan los estados inalcanzables y los que no llegan a un
+ * estado final, así que la tabla sólo contiene estados útiles.
+ *
+ * @param t Transiciones del autómata
+ * @param estadoInicial Estado inicial del autómata
+ * @param estadosFinales Conjunto de estados de aceptación
+ * @return CompiledDFA Tabla del autómata determinista equivalente
+ */
+static CompiledDFA compilarDeterminista(const Transition &t,
+                                        const string &estadoInicial,
+                                        const set<string> &estadosFinales) {
+    // Los estados inútiles sólo agrandarían la tabla y los subconjuntos
+    const Transition podado = trimAutomaton(t, estadoInicial, estadosFinales).delta;
+    if (CompiledDFA::isDeterministic(podado)) {
+        return CompiledDFA(podado, estadoInicial, estadosFinales);
+    }
+    DeterministicAutomaton d = determinize(podado, estadoInicial, estadosFinales);
+    return CompiledDFA(d.delta, d.initialState, d.finalStates);
+}
+
+/**
+ * @brief Verifica si una cadena es aceptada con el motor elegido
+ *
+ * @param t Transiciones del autómata
+ * @param estadoInicial Estado inicial del autómata
+ * @param estadosFinales Conjunto de estados de aceptación
+ * @param cadena Cadena a verificar
+ * @param motor Motor de ejecución
+ * @return true si la cadena es aceptada, false en caso contrario
+ */
+bool esAceptada(const Transition &t,
+                const string &estadoInicial,
+                const set<string> &estadosFinales,
+                const string &cadena,
+                MotorValidacion motor) {
+    switch (motor) {
+        case MotorValidacion::Compilado:
+            return compilarDeterminista(t, estadoInicial, estadosFinales).accepts(cadena);
+        case MotorValidacion::Perezoso: {
+            LazyDFA dfa(t, estadoInicial, estadosFinales);
+            return dfa.accepts(cadena);
+        }
+        case MotorValidacion::Simulacion:
+        default:
+            return esAceptada(t, estadoInicial, estadosFinales, cadena);
+    }
+}
+
+/**
+ * @brief Reparte un lote de cadenas entre los hilos del pool
+ *
+ * Cada tarea procesa un bloque de CADENAS_POR_BLOQUE cadenas (múltiplo de 64),
+ * así que ninguna palabra del mapa de bits es escrita por dos hilos.
+ *
+ * @param acepta Función de aceptación de sólo lectura, compartida por los hilos
+ * @param cadenas Primera cadena del lote
+ * @param cantidad Número de cadenas
+ * @param pool Hilos que ejecutan las tareas
+ * @return vector<uint64_t> Mapa de bits de cadenas aceptadas
+ */
+template <typename Acepta>
+static vector<uint64_t> validarLote(const Acepta &acepta, const string *cadenas,
+                                    size_t cantidad, ThreadPool &pool) {
+    constexpr size_t CADENAS_POR_BLOQUE = 64 * 16;
+    vector<uint64_t> mapa((cantidad + 63) / 64, 0);
+    size_t bloques = (cantidad + CADENAS_POR_BLOQUE - 1) / CADENAS_POR_BLOQUE;
+
+    pool.parallelFor(bloques, [&](size_t bloque) {
+        size_t inicio = bloque * CADENAS_POR_BLOQUE;
+        size_t fin = std::min(cantidad, inicio + CADENAS_POR_BLOQUE);
+        for (size_t i = inicio; i < fin; ++i) {
+            if (acepta(cadenas[i])) mapa[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    });
+    return mapa;
+}
+
+vector<uint64_t> esAceptadaLote(const CompiledDFA &dfa, const string *cadenas,
+                                size_t cantidad, ThreadPool &pool) {
+    return validarLote([&](const string &s) { return dfa.accepts(s); },
+                       cadenas, cantidad, pool);
+}
+
+vector<uint64_t> esAceptadaLote(const NFASimulator &simulador, const string *cadenas,
+                                size_t cantidad, ThreadPool &pool) {
+    return validarLote([&](const string &s) { return simulador.accepts(s); },
+                       cadenas, cantidad, pool);
+}
+
+vector<uint64_t> esAceptadaLote(const Transition &t,
+                                const string &estadoInicial,
+                                const set<string> &estadosFinales,
+                                const vector<string> &cadenas) {
+    // Compilar una sola vez; si la determinización explota, simular el AFN
+    unique_ptr<CompiledDFA> dfa;
+    if (CompiledDFA::isDeterministic(t)) {
+        dfa = std::make_unique<CompiledDFA>(t, estadoInicial, estadosFinales);
+    } else {
+        try {
+            DeterministicAutomaton d = determinize(t, estadoInicial, estadosFinales);
+            dfa = std::make_unique<CompiledDFA>(d.delta, d.initialState, d.finalStates);
+        } catch (const std::length_error &) {
+            NFASimulator simulador(t, estadoInicial, estadosFinales);
+            return esAceptadaLote(simulador, cadenas.data(), cadenas.size());
+        }
+    }
+    return esAceptadaLote(*dfa, cadenas.data(), cadenas.size());
+}
+
+/**
+ * @brief Recorrido en anchura directamente sobre el AFN
+ *
+ * Sólo se usa cuando la determinización excede el límite de estados; emite
+ * una cadena por cada camino de aceptación, así que puede repetir cadenas.
  *
  * @param t Transiciones del autómata
  * @param estadoInicial Estado inicial del autómata
  * @param estadosFinales Conjunto de estados de aceptación
  * @param alfabeto Vector con los símbolos del alfabeto
  * @param longitudMaxima Longitud máxima de las cadenas a generar
- * @return vector<string> Vector con todas las cadenas aceptadas
+ * @return vector<string> Cadenas aceptadas en orden de longitud
  */
-vector<string> generarCadenasAceptadas(const Transition &t,
-                                       const string &estadoInicial,const set<string> &estadosFinales,
-                                       const vector<char> &alfabeto,
-                                       int longitudMaxima) {
+static vector<string> generarPorAnchura(const Transition &t,
+                                        const string &estadoInicial, const set<string> &estadosFinales,
+                                        const vector<char> &alfabeto,
+                                        int longitudMaxima) {
     vector<string> cadenasAceptadas;
     queue<pair<string, string>> cola; // (estado actual, cadena formada)
+    const EpsilonClosure clausura(t);
 
     // Verificar si la cadena vacía es aceptada
-    if (estadosFinales.count(estadoInicial) > 0) {
+    if (cerraduraAcepta(t, clausura, estadoInicial, estadosFinales)) {
         cadenasAceptadas.push_back("");
     }
 
@@ -119,21 +350,24 @@ vector<string> generarCadenasAceptadas(const Transition &t,
             continue;
         }
 
-        // Probar cada símbolo del alfabeto
+        // Probar cada símbolo del alfabeto desde la cerradura del estado actual
+        vector<string> origenes = cerraduraDe(t, clausura, estadoActual);
         for (char simbolo : alfabeto) {
-            vector<string> siguientes = t.getNextStates(estadoActual, simbolo);
-
-            for (const string &siguienteEstado : siguientes) {
-                string nuevaCadena = cadenaActual + simbolo;
-
-                // Si llegamos a un estado final, agregar la cadena
-                if (estadosFinales.count(siguienteEstado) > 0) {
-                    cadenasAceptadas.push_back(nuevaCadena);
-                }
-
-                // Continuar explorando si no hemos alcanzado la longitud máxima
-                if (nuevaCadena.size() < longitudMaxima) {
-                    cola.push({siguienteEstado, nuevaCadena});
+            if (simbolo == Transition::EPSILON) continue;
+            for (const string &origen : origenes) {
+                for (StateId destino : t.getNextStateIds(origen, simbolo)) {
+                    const string &siguienteEstado = t.getStateName(destino);
+                    string nuevaCadena = cadenaActual + simbolo;
+
+                    // Si llegamos a un estado final, agregar la cadena
+                    if (cerraduraAcepta(t, clausura, siguienteEstado, estadosFinales)) {
+                        cadenasAceptadas.push_back(nuevaCadena);
+                    }
+
+                    // Continuar explorando si no hemos alcanzado la longitud máxima
+                    if (nuevaCadena.size() < longitudMaxima) {
+                        cola.push({siguienteEstado, nuevaCadena});
+                    }
                 }
             }
         }
@@ -142,13 +376,114 @@ vector<string> generarCadenasAceptadas(const Transition &t,
     return cadenasAceptadas;
 }
 
+/**
+ * @brief Genera todas las cadenas aceptadas hasta una longitud máxima
+ *
+ * Recorre la forma determinista del autómata con ShortlexEnumerator, así que
+ * cada cadena aparece una sola vez, en orden de longitud y luego de alfabeto.
+ *
+ * @param t Transiciones del autómata
+ * @param estadoInicial Estado inicial del autómata
+ * @param estadosFinales Conjunto de estados de aceptación
+ * @param alfabeto Vector con los símbolos del alfabeto
+ * @param longitudMaxima Longitud máxima de las cadenas a generar
+ * @return vector<string> Vector con todas las cadenas aceptadas
+ */
+vector<string> generarCadenasAceptadas(const Transition &t,
+                                       const string &estadoInicial, const set<string> &estadosFinales,
+                                       const vector<char> &alfabeto,
+                                       int longitudMaxima) {
+    if (longitudMaxima < 0) return {};
+    unique_ptr<CompiledDFA> dfa;
+    try {
+        dfa = std::make_unique<CompiledDFA>(compilarDeterminista(t, estadoInicial, estadosFinales));
+    } catch (const std::length_error &) {
+        return generarPorAnchura(trimAutomaton(t, estadoInicial, estadosFinales).delta,
+                                 estadoInicial, estadosFinales, alfabeto, longitudMaxima);
+    }
+
+    vector<string> cadenasAceptadas;
+    ShortlexEnumerator enumerador(*dfa, alfabeto, static_cast<size_t>(longitudMaxima));
+    while (enumerador.next()) cadenasAceptadas.push_back(enumerador.current());
+    return cadenasAceptadas;
+}
+
+/**
+ * @brief Genera las cadenas aceptadas repartiendo el árbol de búsqueda entre hilos
+ *
+ * @param t Transiciones del autómata
+ * @param estadoInicial Estado inicial del autómata
+ * @param estadosFinales Conjunto de estados de aceptación
+ * @param alfabeto Vector con los símbolos del alfabeto
+ * @param longitudMaxima Longitud máxima de las cadenas a generar
+ * @param pool Hilos que exploran los subárboles
+ * @return vector<string> Las mismas cadenas, en el mismo orden, que generarCadenasAceptadas()
+ */
+vector<string> generarCadenasAceptadasParalelo(const Transition &t,
+                                               const string &estadoInicial,
+                                               const set<string> &estadosFinales,
+                                               const vector<char> &alfabeto,
+                                               int longitudMaxima,
+                                               ThreadPool &pool) {
+    if (longitudMaxima < 0) return {};
+    unique_ptr<CompiledDFA> dfa;
+    try {
+        dfa = std::make_unique<CompiledDFA>(compilarDeterminista(t, estadoInicial, estadosFinales));
+    } catch (const std::length_error &) {
+        // Igual que generarCadenasAceptadas, sin repetir la determinización que ya falló
+        return generarPorAnchura(trimAutomaton(t, estadoInicial, estadosFinales).delta,
+                                 estadoInicial, estadosFinales, alfabeto, longitudMaxima);
+    }
+    return generateShortlexParallel(*dfa, alfabeto, static_cast<size_t>(longitudMaxima), pool);
+}
+
+/**
+ * @brief Recorrido en profundidad de generarCadenasConLimite()
+ *
+ * Mantiene una sola cadena y un solo arreglo de visitas por estado para el
+ * camino actual: al entrar a un estado se incrementa su contador y al salir
+ * se decrementa, así que la memoria es O(|Q| + longitudMaxima) sin importar
+ * cuántos caminos se exploren. Las cadenas se agrupan por longitud para
+ * devolverlas en el mismo orden que el recorrido en anchura original.
+ */
+struct GeneradorConLimite {
+    const Transition &t;
+    const vector<char> &alfabeto;
+    size_t longitudMaxima;
+    uint32_t limiteCiclos;
+    vector<vector<StateId>> cerraduras; ///< Cerradura épsilon de cada id, en orden ascendente
+    vector<char> acepta;                ///< Si la cerradura de cada id contiene un estado final
+    vector<uint32_t> visitas;           ///< Veces que cada id aparece en el camino actual
+    string cadena;                      ///< Cadena del camino actual
+    vector<vector<string>> porLongitud; ///< Cadenas aceptadas agrupadas por longitud
+
+    void explorar(StateId estado) {
+        for (char simbolo : alfabeto) {
+            if (simbolo == Transition::EPSILON) continue;
+            for (StateId origen : cerraduras[estado]) {
+                for (StateId destino : t.getNextStates(origen, simbolo)) {
+                    // Limitar ciclos
+                    if (visitas[destino] >= limiteCiclos) continue;
+
+                    ++visitas[destino];
+                    cadena.push_back(simbolo);
+                    if (acepta[destino]) porLongitud[cadena.size()].push_back(cadena);
+                    if (cadena.size() < longitudMaxima) explorar(destino);
+                    cadena.pop_back();
+                    --visitas[destino];
+                }
+            }
+        }
+    }
+};
+
 /**
  * @brief Genera todas las combinaciones posibles limitando ciclos
  *
  * Esta versión es más eficiente para autómatas con ciclos,
  * limitando la exploración de caminos repetitivos.
  *
- * @param t Transiciones del autómata
+ * @param original Transiciones del autómata (se podan antes de explorar)
  * @param estadoInicial Estado inicial del autómata
  * @param estadosFinales Conjunto de estados de aceptación
  * @param alfabeto Vector con los símbolos del alfabeto
@@ -156,7 +491,7 @@ vector<string> generarCadenasAceptadas(const Transition &t,
  * @param limiteCiclos Límite de veces que se puede visitar un estado
  * @return vector<string> Vector con cadenas aceptadas
  */
-vector<string> generarCadenasConLimite(const Transition &t,
+vector<string> generarCadenasConLimite(const Transition &original,
                                        const string &estadoInicial,
                                        const set<string> &estadosFinales,
                                        const vector<char> &alfabeto,
@@ -164,62 +499,92 @@ vector<string> generarCadenasConLimite(const Transition &t,
                                        int limiteCiclos) {
     vector<string> cadenasAceptadas;
 
-    // Estructura: (estado, cadena, mapa de visitas por estado)
-    struct Exploracion {
-        string estado;
-        string cadena;
-        map<string, int> visitas;
-    };
-
-    queue<Exploracion> cola;
+    // Las ramas que pasan por estados inútiles nunca producen cadenas
+    const Transition t = trimAutomaton(original, estadoInicial, estadosFinales).delta;
+    const EpsilonClosure clausura(t);
 
     // Verificar cadena vacía
-    if (estadosFinales.count(estadoInicial) > 0) {
+    if (cerraduraAcepta(t, clausura, estadoInicial, estadosFinales)) {
         cadenasAceptadas.push_back("");
     }
 
-    // Inicializar
-    Exploracion inicial;
-    inicial.estado = estadoInicial;
-    inicial.cadena = "";
-    inicial.visitas[estadoInicial] = 1;
-    cola.push(inicial);
-
-    while (!cola.empty()) {
-        Exploracion actual = cola.front();
-        cola.pop();
+    StateId inicial = t.getStateId(estadoInicial);
+    if (inicial == Transition::INVALID_STATE || longitudMaxima <= 0 || limiteCiclos < 1) {
+        return cadenasAceptadas; // sin transiciones desde el estado inicial
+    }
 
-        if (actual.cadena.size() >= longitudMaxima) {
-            continue;
+    const size_t n = t.getStateCount();
+    GeneradorConLimite generador{t, alfabeto, static_cast<size_t>(longitudMaxima),
+                                 static_cast<uint32_t>(limiteCiclos), {}, {}, {}, {}, {}};
+    generador.cerraduras.resize(n);
+    generador.acepta.assign(n, 0);
+    StateBitset bits(n);
+    for (StateId id = 0; id < n; ++id) {
+        if (clausura.isTrivial()) {
+            generador.cerraduras[id].push_back(id);
+        } else {
+            bits.clear();
+            clausura.addClosure(id, bits);
+            bits.forEach([&](StateId s) { generador.cerraduras[id].push_back(s); });
         }
-
-        for (char simbolo : alfabeto) {
-            vector<string> siguientes = t.getNextStates(actual.estado, simbolo);
-
-            for (const string &siguienteEstado : siguientes) {
-                Exploracion nueva;
-                nueva.estado = siguienteEstado;
-                nueva.cadena = actual.cadena + simbolo;
-                nueva.visitas = actual.visitas;
-                nueva.visitas[siguienteEstado]++;
-
-                // Limitar ciclos
-                if (nueva.visitas[siguienteEstado] > limiteCiclos) {
-                    continue;
-                }
-
-                // Si es estado final, guardar
-                if (estadosFinales.count(siguienteEstado) > 0) {
-                    cadenasAceptadas.push_back(nueva.cadena);
-                }
-
-                // Continuar explorando
-                if (nueva.cadena.size() < longitudMaxima) {
-                    cola.push(nueva);
-                }
-            }
+        for (StateId s : generador.cerraduras[id]) {
+            if (estadosFinales.count(t.getStateName(s))) generador.acepta[id] = 1;
         }
     }
+    generador.visitas.assign(n, 0);
+    generador.visitas[inicial] = 1;
+    generador.cadena.reserve(longitudMaxima);
+    generador.porLongitud.resize(longitudMaxima + 1);
+
+    generador.explorar(inicial);
 
+    for (vector<string> &grupo : generador.porLongitud) {
+        for (string &cadena : grupo) cadenasAceptadas.push_back(std::move(cadena));
+    }
     return cadenasAceptadas;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Cuenta las cadenas aceptadas de cada longitud sin enumerarlas
+ *
+ * @param t Transiciones del autómata
+ * @param estadoInicial Estado inicial del autómata
+ * @param estadosFinales Conjunto de estados de aceptación
+ * @param longitudMaxima Longitud máxima a contar
+ * @return vector<BigCount> Número de cadenas aceptadas de longitud 0..longitudMaxima
+ */
+vector<BigCount> contarCadenasAceptadas(const Transition &t,
+                                        const string &estadoInicial,
+                                        const set<string> &estadosFinales,
+                                        size_t longitudMaxima) {
+    CompiledDFA dfa = compilarDeterminista(t, estadoInicial, estadosFinales);
+    return LanguageCounter(dfa).countByLength(longitudMaxima);
+}
+
+/**
+ * @brief Elige cadenas aceptadas de una longitud dada con probabilidad uniforme
+ *
+ * @param t Transiciones del autómata
+ * @param estadoInicial Estado inicial del autómata
+ * @param estadosFinales Conjunto de estados de aceptación
+ * @param longitud Longitud de las cadenas
+ * @param cantidad Número de cadenas a generar
+ * @param semilla Semilla del generador aleatorio
+ * @return vector<string> Cadenas elegidas (vacío si ninguna cadena de esa longitud es aceptada)
+ */
+vector<string> muestrearCadenasAceptadas(const Transition &t,
+                                         const string &estadoInicial,
+                                         const set<string> &estadosFinales,
+                                         size_t longitud,
+                                         size_t cantidad,
+                                         uint64_t semilla) {
+    CompiledDFA dfa = compilarDeterminista(t, estadoInicial, estadosFinales);
+    StringSampler muestreador(dfa, longitud);
+    vector<string> cadenas;
+    if (muestreador.empty()) return cadenas;
+
+    mt19937_64 rng(semilla);
+    cadenas.reserve(cantidad);
+    for (size_t i = 0; i < cantidad; ++i) cadenas.push_back(muestreador.sample(rng));
+    return cadenas;
+}
@@ -1,6 +1,8 @@
 #ifndef VALIDACION_CADENA_H
 #define VALIDACION_CADENA_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <set>
@@ -8,6 +10,12 @@
 // This header assumes a "Transition.h" file exists which defines the Transition class.
 // Make sure you have this file and it defines the 'getNextStates' method.
 #include "Transition.h"
+#include "BigCount.h"
+#include "CompiledDFA.h"
+#include "EpsilonClosure.h"
+#include "LazyDFA.h"
+#include "NFASimulator.h"
+#include "ThreadPool.h"
 
 /**
  * @brief Valida una cadena en el autómata y devuelve los estados finales alcanzados.
@@ -20,6 +28,24 @@ std::set<std::string> validarCadena(const Transition &t,
                                     const std::string &estadoInicial,
                                     const std::string &cadena);
 
+/**
+ * @brief Igual que validarCadena(t, estadoInicial, cadena), con cerraduras precalculadas.
+ *
+ * Las otras sobrecargas sobre Transition calculan las cerraduras épsilon en
+ * cada llamada; para validar muchas cadenas conviene construir un
+ * EpsilonClosure(t) una vez y pasarlo aquí.
+ * @param t Las transiciones del autómata.
+ * @param clausura Cerraduras épsilon de t.
+ * @param estadoInicial El estado inicial del autómata.
+ * @param cadena La cadena a validar.
+ * @return Los estados alcanzados después de procesar la cadena.
+ * @throws std::invalid_argument Si clausura cubre menos estados que t.
+ */
+std::set<std::string> validarCadena(const Transition &t,
+                                    const EpsilonClosure &clausura,
+                                    const std::string &estadoInicial,
+                                    const std::string &cadena);
+
 /**
  * @brief Verifica si una cadena es aceptada por el autómata.
  * @param t Transiciones del autómata.
@@ -33,8 +59,147 @@ bool esAceptada(const Transition &t,
                 const std::set<std::string> &estadosFinales,
                 const std::string &cadena);
 
+/**
+ * @brief Igual que esAceptada(t, estadoInicial, estadosFinales, cadena), con cerraduras precalculadas.
+ * @param t Transiciones del autómata.
+ * @param clausura Cerraduras épsilon de t, construidas una vez con EpsilonClosure(t).
+ * @param estadoInicial Estado inicial del autómata.
+ * @param estadosFinales Conjunto de estados de aceptación.
+ * @param cadena Cadena a verificar.
+ * @return true si la cadena es aceptada, false en caso contrario.
+ * @throws std::invalid_argument Si clausura cubre menos estados que t.
+ */
+bool esAceptada(const Transition &t,
+                const EpsilonClosure &clausura,
+                const std::string &estadoInicial,
+                const std::set<std::string> &estadosFinales,
+                const std::string &cadena);
+
+/**
+ * @brief Verifica si una cadena es aceptada usando un autómata determinista compilado.
+ *
+ * Es la ruta rápida para validar muchas cadenas contra el mismo autómata:
+ * compila una vez con CompiledDFA y reutiliza el resultado en cada llamada.
+ * @param dfa Autómata compilado.
+ * @param cadena Cadena a verificar.
+ * @return true si la cadena es aceptada, false en caso contrario.
+ */
+bool esAceptada(const CompiledDFA &dfa, const std::string &cadena);
+
+/**
+ * @brief Verifica si una cadena es aceptada simulando el AFN con bitsets.
+ *
+ * Útil cuando el autómata no se puede determinizar dentro del límite de
+ * estados: los sucesores de cada (estado, símbolo) se precalculan una vez.
+ * @param simulador Simulador del autómata.
+ * @param cadena Cadena a verificar.
+ * @return true si la cadena es aceptada, false en caso contrario.
+ */
+bool esAceptada(const NFASimulator &simulador, const std::string &cadena);
+
+/**
+ * @brief Verifica si una cadena es aceptada con un AFD perezoso.
+ *
+ * Los estados del AFD se construyen conforme la cadena los alcanza y se
+ * guardan en la caché del LazyDFA, así que conviene reutilizar el mismo objeto
+ * para muchas cadenas y consultar sus estadísticas con getStats().
+ * @param dfa Autómata perezoso (su caché se actualiza).
+ * @param cadena Cadena a verificar.
+ * @return true si la cadena es aceptada, false en caso contrario.
+ */
+bool esAceptada(LazyDFA &dfa, const std::string &cadena);
+
+/**
+ * @brief Motor con el que esAceptada() ejecuta el autómata.
+ */
+enum class MotorValidacion {
+    Simulacion, ///< Conjunto de estados activos sobre Transition (validarCadena)
+    Compilado,  ///< Determinización completa y tabla CompiledDFA
+    Perezoso    ///< AFD construido bajo demanda con LazyDFA
+};
+
+/**
+ * @brief Verifica si una cadena es aceptada usando el motor indicado.
+ *
+ * Construye el motor para esta única llamada; para validar muchas cadenas es
+ * mejor construir CompiledDFA, NFASimulator o LazyDFA una vez y usar las
+ * sobrecargas correspondientes.
+ * @param t Transiciones del autómata.
+ * @param estadoInicial Estado inicial del autómata.
+ * @param estadosFinales Conjunto de estados de aceptación.
+ * @param cadena Cadena a verificar.
+ * @param motor Motor de ejecución.
+ * @return true si la cadena es aceptada, false en caso contrario.
+ * @throws std::length_error Si motor es Compilado y la determinización excede el límite de estados.
+ */
+bool esAceptada(const Transition &t,
+                const std::string &estadoInicial,
+                const std::set<std::string> &estadosFinales,
+                const std::string &cadena,
+                MotorValidacion motor);
+
+/**
+ * @brief Valida un lote de cadenas en paralelo contra un autómata compilado.
+ *
+ * Las cadenas se reparten en bloques de 64·k entre los hilos del pool; todos
+ * comparten el mismo CompiledDFA de sólo lectura y cada bloque escribe sus
+ * propias palabras del resultado.
+ * @param dfa Autómata compilado.
+ * @param cadenas Puntero a la primera cadena del lote.
+ * @param cantidad Número de cadenas del lote.
+ * @param pool Hilos que ejecutan la validación.
+ * @return Mapa de bits empaquetado: la cadena i es aceptada si el bit i % 64
+ *         de la palabra i / 64 está encendido.
+ */
+std::vector<std::uint64_t> esAceptadaLote(const CompiledDFA &dfa,
+                                          const std::string *cadenas,
+                                          std::size_t cantidad,
+                                          ThreadPool &pool = ThreadPool::global());
+
+/**
+ * @brief Valida un lote de cadenas en paralelo simulando el AFN con bitsets.
+ *
+ * Igual que la versión para CompiledDFA, para autómatas que no se pueden
+ * determinizar dentro del límite de estados.
+ */
+std::vector<std::uint64_t> esAceptadaLote(const NFASimulator &simulador,
+                                          const std::string *cadenas,
+                                          std::size_t cantidad,
+                                          ThreadPool &pool = ThreadPool::global());
+
+/**
+ * @brief Valida un lote de cadenas en paralelo contra un autómata.
+ *
+ * Compila el autómata una sola vez (determinizándolo si hace falta, o con
+ * NFASimulator si excede el límite de estados) y reparte las cadenas entre
+ * los hilos de ThreadPool::global().
+ * @param t Transiciones del autómata.
+ * @param estadoInicial Estado inicial del autómata.
+ * @param estadosFinales Conjunto de estados de aceptación.
+ * @param cadenas Cadenas a verificar.
+ * @return Mapa de bits empaquetado, ver esAceptadaLote(const CompiledDFA&, ...).
+ */
+std::vector<std::uint64_t> esAceptadaLote(const Transition &t,
+                                          const std::string &estadoInicial,
+                                          const std::set<std::string> &estadosFinales,
+                                          const std::vector<std::string> &cadenas);
+
+/**
+ * @brief Consulta el resultado de una cadena en un mapa de bits de esAceptadaLote().
+ * @param mapa Mapa de bits devuelto por esAceptadaLote().
+ * @param i Índice de la cadena en el lote.
+ * @return true si la cadena i fue aceptada.
+ */
+inline bool aceptadaEnLote(const std::vector<std::uint64_t> &mapa, std::size_t i) {
+    return (mapa[i >> 6] >> (i & 63)) & 1;
+}
+
 /**
  * @brief Genera todas las cadenas aceptadas hasta una longitud máxima.
+ *
+ * Las cadenas salen en orden shortlex (por longitud y luego en el orden de
+ * alfabeto), sin repetidas. Para detenerse tras las primeras k cadenas sin
+ * generar el resto, usar ShortlexEnumerator directamente.
  * @param t Transiciones del autómata.
  * @param estadoInicial Estado inicial del autómata.
  * @param estadosFinales Conjunto de estados de aceptación.
@@ -48,6 +213,27 @@ std::vector<std::string> generarCadenasAceptadas(const Transition &t,
                                                    const std::vector<char> &alfabeto,
                                                    int longitudMaxima);
 
+/**
+ * @brief Genera todas las cadenas aceptadas hasta una longitud máxima usando varios hilos.
+ *
+ * Divide la búsqueda en subárboles por prefijo y los explora en el pool (ver
+ * generateShortlexParallel()); el resultado es idéntico al de
+ * generarCadenasAceptadas(), en orden shortlex y sin repetidas.
+ * @param t Transiciones del autómata.
+ * @param estadoInicial Estado inicial del autómata.
+ * @param estadosFinales Conjunto de estados de aceptación.
+ * @param alfabeto Vector con los símbolos del alfabeto.
+ * @param longitudMaxima Longitud máxima de las cadenas a generar.
+ * @param pool Hilos que exploran los subárboles.
+ * @return Un vector con todas las cadenas aceptadas.
+ */
+std::vector<std::string> generarCadenasAceptadasParalelo(const Transition &t,
+                                                           const std::string &estadoInicial,
+                                                           const std::set<std::string> &estadosFinales,
+                                                           const std::vector<char> &alfabeto,
+                                                           int longitudMaxima,
+                                                           ThreadPool &pool = ThreadPool::global());
+
 /**
  * @brief Genera todas las combinaciones posibles limitando la exploración de ciclos.
  * @param t Transiciones del autómata.
@@ -65,4 +251,44 @@ std::vector<std::string> generarCadenasConLimite(const Transition &t,
                                                    int longitudMaxima,
                                                    int limiteCiclos = 2);
 
+/**
+ * @brief Cuenta las cadenas aceptadas de cada longitud sin enumerarlas.
+ *
+ * Determiniza el autómata y aplica programación dinámica sobre la tabla
+ * (ver LanguageCounter), así que el costo es O(n·|Q|·|Σ|) operaciones con
+ * enteros de precisión arbitraria en lugar de probar |Σ|^n cadenas.
+ * @param t Transiciones del autómata.
+ * @param estadoInicial Estado inicial del autómata.
+ * @param estadosFinales Conjunto de estados de aceptación.
+ * @param longitudMaxima Longitud máxima a contar.
+ * @return Elemento k: número de cadenas aceptadas de longitud k, para k = 0..longitudMaxima.
+ * @throws std::length_error Si la determinización excede el límite de estados.
+ */
+std::vector<BigCount> contarCadenasAceptadas(const Transition &t,
+                                             const std::string &estadoInicial,
+                                             const std::set<std::string> &estadosFinales,
+                                             std::size_t longitudMaxima);
+
+/**
+ * @brief Genera cadenas aceptadas de una longitud dada, uniformemente al azar.
+ *
+ * Cada cadena aceptada de esa longitud tiene la misma probabilidad de salir
+ * (ver StringSampler); la misma semilla produce siempre las mismas cadenas.
+ * @param t Transiciones del autómata.
+ * @param estadoInicial Estado inicial del autómata.
+ * @param estadosFinales Conjunto de estados de aceptación.
+ * @param longitud Longitud de las cadenas.
+ * @param cantidad Número de cadenas a generar (pueden repetirse).
+ * @param semilla Semilla del generador aleatorio.
+ * @return Las cadenas generadas, o un vector vacío si ninguna cadena de esa longitud es aceptada.
+ * @throws std::length_error Si la determinización excede el límite de estados o la
+ *         tabla de conteos excede StringSampler::DEFAULT_MAX_BYTES.
+ */
+std::vector<std::string> muestrearCadenasAceptadas(const Transition &t,
+                                                   const std::string &estadoInicial,
+                                                   const std::set<std::string> &estadosFinales,
+                                                   std::size_t longitud,
+                                                   std::size_t cantidad,
+                                                   std::uint64_t semilla);
+
 #endif // VALIDACION_CADENA_H
\ No newline at end of file
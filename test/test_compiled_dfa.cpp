@@ -0,0 +1,347 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ByteClasses.h"
+#include "CompiledDFA.h"
+#include "Determinization.h"
+#include "Minimization.h"
+#include "ShortlexEnumerator.h"
+#include "ShuffleDFA.h"
+#include "StreamMatcher.h"
+#include "Transition.h"
+#include "validacion_cadenas.h"
+
+// DFA over {0,1} accepting binary strings that end in '1'
+class CompiledDFATest : public ::testing::Test {
+protected:
+    Transition ends_in_one;
+    std::set<std::string> ends_in_one_final = {"A"};
+
+    void SetUp() override {
+        ends_in_one.addTransition("S", '0', "S");
+        ends_in_one.addTransition("S", '1', "A");
+        ends_in_one.addTransition("A", '0', "S");
+        ends_in_one.addTransition("A", '1', "A");
+    }
+};
+
+TEST_F(CompiledDFATest, AcceptsSameLanguageAsEsAceptada) {
+    CompiledDFA dfa(ends_in_one, "S", ends_in_one_final);
+    for (const std::string s : {"", "0", "1", "01", "10", "0101", "0110", "111"}) {
+        EXPECT_EQ(dfa.accepts(s), esAceptada(ends_in_one, "S", ends_in_one_final, s)) << s;
+        EXPECT_EQ(esAceptada(dfa, s), esAceptada(ends_in_one, "S", ends_in_one_final, s)) << s;
+    }
+}
+
+TEST_F(CompiledDFATest, SymbolsOutsideAlphabetGoToDeadState) {
+    CompiledDFA dfa(ends_in_one, "S", ends_in_one_final);
+    EXPECT_FALSE(dfa.accepts("1x1"));
+    EXPECT_FALSE(dfa.accepts(std::string("1\0", 2)));
+    EXPECT_EQ(dfa.next(dfa.getInitialState(), 'x'), CompiledDFA::DEAD_STATE);
+}
+
+TEST_F(CompiledDFATest, TableShape) {
+    CompiledDFA dfa(ends_in_one, "S", ends_in_one_final);
+    EXPECT_EQ(dfa.getStateCount(), 3);  // dead + S + A
+    EXPECT_EQ(dfa.getClassCount(), 3);  // other + '0' + '1'
+    EXPECT_EQ(dfa.getTableBytes(), 3 * 3 * sizeof(uint32_t));
+    EXPECT_EQ(dfa.getByteClass('z'), 0);
+}
+
+TEST(CompiledDFAStandaloneTest, InterchangeableSymbolsShareAColumn) {
+    // Identifier-like language: [a-z][a-z0-9]*; letters and digits each collapse to one class
+    Transition ident;
+    for (char c = 'a'; c <= 'z'; ++c) {
+        ident.addTransition("S", c, "I");
+        ident.addTransition("I", c, "I");
+    }
+    for (char c = '0'; c <= '9'; ++c) ident.addTransition("I", c, "I");
+
+    ByteClasses classes(ident);
+    EXPECT_EQ(classes.getClassCount(), 3u); // other + digits + letters
+    EXPECT_EQ(classes.classOf('0'), classes.classOf('9'));
+    EXPECT_EQ(classes.classOf('a'), classes.classOf('z'));
+    EXPECT_NE(classes.classOf('a'), classes.classOf('0'));
+    EXPECT_EQ(classes.classOf('_'), 0);
+    EXPECT_EQ(classes.getRepresentative(classes.classOf('7')), '0');
+
+    CompiledDFA dfa(ident, "S", {"I"});
+    EXPECT_EQ(dfa.getClassCount(), 3u);
+    EXPECT_TRUE(dfa.accepts("x42"));
+    EXPECT_FALSE(dfa.accepts("4x"));
+    EXPECT_FALSE(dfa.accepts("a_b"));
+}
+
+TEST(CompiledDFAStandaloneTest, InitialStateWithoutTransitions) {
+    Transition empty;
+    CompiledDFA accepting(empty, "q0", {"q0"});
+    EXPECT_TRUE(accepting.accepts(""));
+    EXPECT_FALSE(accepting.accepts("a"));
+
+    CompiledDFA rejecting(empty, "q0", {});
+    EXPECT_FALSE(rejecting.accepts(""));
+}
+
+TEST(CompiledDFAStandaloneTest, RejectsNondeterminism) {
+    Transition nfa;
+    nfa.addTransition("q0", 'a', "q0");
+    nfa.addTransition("q0", 'a', "q1");
+    EXPECT_FALSE(CompiledDFA::isDeterministic(nfa));
+    EXPECT_THROW(CompiledDFA(nfa, "q0", {"q1"}), std::invalid_argument);
+
+    Transition eps;
+    eps.addTransition("q0", '\0', "q1");
+    EXPECT_FALSE(CompiledDFA::isDeterministic(eps));
+    EXPECT_THROW(CompiledDFA(eps, "q0", {"q1"}), std::invalid_argument);
+}
+
+// --- Subset construction ---
+
+TEST(DeterminizationTest, NFAForAPlusB) {
+    Transition nfa;
+    nfa.addTransition("q0", 'a', "q0");
+    nfa.addTransition("q0", 'a', "q1");
+    nfa.addTransition("q1", 'b', "q2");
+    std::set<std::string> finals = {"q2"};
+
+    DeterministicAutomaton dfa = determinize(nfa, "q0", finals);
+    EXPECT_TRUE(CompiledDFA::isDeterministic(dfa.delta));
+    EXPECT_EQ(dfa.initialState, "{q0}");
+    EXPECT_EQ(dfa.delta.getStateCount(), 3); // {q0}, {q0,q1}, {q2}
+    EXPECT_EQ(dfa.finalStates, std::set<std::string>{"{q2}"});
+
+    CompiledDFA compiled(dfa.delta, dfa.initialState, dfa.finalStates);
+    for (const std::string s : {"", "a", "b", "ab", "aab", "aaab", "abb", "ba"}) {
+        EXPECT_EQ(compiled.accepts(s), esAceptada(nfa, "q0", finals, s)) << s;
+    }
+}
+
+TEST(DeterminizationTest, StateCapIsEnforced) {
+    // "n-th symbol from the end is 'a'" needs 2^n DFA states
+    const int n = 6;
+    Transition nfa;
+    nfa.addTransition("s0", 'a', "s0");
+    nfa.addTransition("s0", 'b', "s0");
+    nfa.addTransition("s0", 'a', "s1");
+    for (int i = 1; i < n; ++i) {
+        nfa.addTransition("s" + std::to_string(i), 'a', "s" + std::to_string(i + 1));
+        nfa.addTransition("s" + std::to_string(i), 'b', "s" + std::to_string(i + 1));
+    }
+    std::set<std::string> finals = {"s" + std::to_string(n)};
+
+    EXPECT_THROW(determinize(nfa, "s0", finals, 16), std::length_error);
+    DeterministicAutomaton dfa = determinize(nfa, "s0", finals, 1 << n);
+    EXPECT_EQ(dfa.delta.getStateCount(), 1u << n);
+}
+
+TEST(DeterminizationTest, InitialStateWithoutTransitions) {
+    Transition empty;
+    DeterministicAutomaton dfa = determinize(empty, "q0", {"q0"});
+    CompiledDFA compiled(dfa.delta, dfa.initialState, dfa.finalStates);
+    EXPECT_TRUE(compiled.accepts(""));
+    EXPECT_FALSE(compiled.accepts("a"));
+}
+
+// --- Hopcroft minimization ---
+
+TEST(MinimizationTest, CollapsesRedundantCycle) {
+    // 12-state cycle on 'a' accepting every 4th position: the minimal DFA has 4 states
+    DeterministicAutomaton dfa;
+    dfa.initialState = "p0";
+    for (int i = 0; i < 12; ++i) {
+        dfa.delta.addTransition("p" + std::to_string(i), 'a', "p" + std::to_string((i + 1) % 12));
+        if (i % 4 == 0) dfa.finalStates.insert("p" + std::to_string(i));
+    }
+
+    MinimizationResult min = minimize(dfa);
+    EXPECT_EQ(min.automaton.delta.getStateCount(), 4);
+    EXPECT_EQ(min.automaton.initialState, "q0");
+    EXPECT_EQ(min.stateMapping.at("p0"), "q0");
+    EXPECT_EQ(min.stateMapping.at("p4"), "q0");
+    EXPECT_EQ(min.stateMapping.at("p5"), min.stateMapping.at("p9"));
+
+    CompiledDFA before(dfa.delta, dfa.initialState, dfa.finalStates);
+    CompiledDFA after(min.automaton.delta, min.automaton.initialState, min.automaton.finalStates);
+    std::string s;
+    for (int len = 0; len < 30; ++len, s += 'a') {
+        EXPECT_EQ(before.accepts(s), after.accepts(s)) << len;
+    }
+}
+
+TEST(MinimizationTest, DropsUnreachableAndDeadStates) {
+    DeterministicAutomaton dfa;
+    dfa.initialState = "A";
+    dfa.finalStates = {"C"};
+    dfa.delta.addTransition("A", 'a', "B");
+    dfa.delta.addTransition("A", 'b', "D");     // D can never accept
+    dfa.delta.addTransition("D", 'a', "D");
+    dfa.delta.addTransition("B", 'b', "C");
+    dfa.delta.addTransition("U", 'a', "C");     // U is unreachable
+
+    MinimizationResult min = minimize(dfa);
+    EXPECT_EQ(min.automaton.delta.getStateCount(), 3);
+    EXPECT_EQ(min.stateMapping.count("D"), 0);
+    EXPECT_EQ(min.stateMapping.count("U"), 0);
+    EXPECT_TRUE(min.automaton.delta.getNextStates("q0", 'b').empty());
+
+    CompiledDFA after(min.automaton.delta, min.automaton.initialState, min.automaton.finalStates);
+    EXPECT_TRUE(after.accepts("ab"));
+    EXPECT_FALSE(after.accepts("ba"));
+}
+
+TEST(MinimizationTest, MinimizesDeterminizedNFA) {
+    // (a|b)*a(a|b): determinization yields 4 states, all distinguishable
+    Transition nfa;
+    nfa.addTransition("s0", 'a', "s0");
+    nfa.addTransition("s0", 'b', "s0");
+    nfa.addTransition("s0", 'a', "s1");
+    nfa.addTransition("s1", 'a', "s2");
+    nfa.addTransition("s1", 'b', "s2");
+    DeterministicAutomaton dfa = determinize(nfa, "s0", {"s2"});
+    MinimizationResult min = minimize(dfa);
+    EXPECT_EQ(min.automaton.delta.getStateCount(), 4);
+
+    MinimizationResult again = minimize(min.automaton);
+    EXPECT_EQ(again.automaton.delta.getStateCount(), 4);
+}
+
+TEST(MinimizationTest, RejectsNondeterministicInput) {
+    DeterministicAutomaton dfa;
+    dfa.initialState = "q0";
+    dfa.delta.addTransition("q0", 'a', "q0");
+    dfa.delta.addTransition("q0", 'a', "q1");
+    EXPECT_THROW(minimize(dfa), std::invalid_argument);
+}
+
+TEST(StreamMatcherTest, ChunkBoundariesDoNotMatter) {
+    // NFA for strings containing "abba"; the match straddles chunk boundaries
+    Transition nfa;
+    nfa.addTransition("s0", 'a', "s0");
+    nfa.addTransition("s0", 'b', "s0");
+    nfa.addTransition("s0", 'a', "s1");
+    nfa.addTransition("s1", 'b', "s2");
+    nfa.addTransition("s2", 'b', "s3");
+    nfa.addTransition("s3", 'a', "s4");
+    nfa.addTransition("s4", 'a', "s4");
+    nfa.addTransition("s4", 'b', "s4");
+    StreamMatcher matcher(nfa, "s0", {"s4"});
+
+    const std::string input = "babbbaabbabab";
+    for (size_t cut = 0; cut <= input.size(); ++cut) {
+        matcher.reset();
+        matcher.feed(input.data(), cut);
+        matcher.feed(input.data() + cut, input.size() - cut);
+        EXPECT_TRUE(matcher.isAccepting()) << cut;
+        EXPECT_EQ(matcher.getConsumed(), input.size());
+    }
+
+    // finish() reports the verdict and starts a new input
+    EXPECT_TRUE(matcher.finish());
+    matcher.feed("ab", 2);
+    EXPECT_FALSE(matcher.finish());
+    EXPECT_EQ(matcher.getConsumed(), 0u);
+    matcher.feed("abba", 4);
+    EXPECT_TRUE(matcher.finish());
+}
+
+TEST(StreamMatcherTest, DeadStateSkipsRemainingInput) {
+    Transition t;
+    t.addTransition("q0", 'a', "q0");
+    StreamMatcher matcher(t, "q0", {"q0"});
+    matcher.feed("aaa", 3);
+    EXPECT_TRUE(matcher.isAccepting());
+    matcher.feed("ab", 2);
+    EXPECT_TRUE(matcher.isDead());
+    matcher.feed("aaaa", 4);
+    EXPECT_FALSE(matcher.isAccepting());
+    EXPECT_EQ(matcher.getConsumed(), 9u);
+}
+
+TEST(ShortlexEnumeratorTest, ShortlexOrderWithoutDuplicates) {
+    // NFA for (a|b)*b with two accepting paths for "bb"
+    Transition nfa;
+    nfa.addTransition("p", 'a', "p");
+    nfa.addTransition("p", 'b', "p");
+    nfa.addTransition("p", 'b', "f");
+    nfa.addTransition("f", 'b', "f");
+    DeterministicAutomaton d = determinize(nfa, "p", {"f"});
+    CompiledDFA dfa(d.delta, d.initialState, d.finalStates);
+
+    ShortlexEnumerator it(dfa, {'a', 'b', 'a'}, 3);
+    std::vector<std::string> out;
+    while (it.next()) out.push_back(it.current());
+    EXPECT_EQ(out, (std::vector<std::string>{"b", "ab", "bb", "aab", "abb", "bab", "bbb"}));
+    EXPECT_FALSE(it.next());
+
+    // Resumable: stopping early and restarting gives the same prefix
+    it.reset();
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.current(), "b");
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.current(), "ab");
+}
+
+TEST(ShortlexEnumeratorTest, PrunesBranchesThatCannotFinish) {
+    // Only "a" followed by 60 'b's is accepted; the other 2^60 prefixes are never entered
+    Transition t;
+    t.addTransition("s0", 'a', "s1");
+    for (int i = 1; i <= 60; ++i) {
+        t.addTransition("s" + std::to_string(i), 'b', "s" + std::to_string(i + 1));
+        t.addTransition("s" + std::to_string(i), 'a', "trap");
+    }
+    t.addTransition("trap", 'a', "trap");
+    t.addTransition("trap", 'b', "trap");
+    CompiledDFA dfa(t, "s0", {"s61", "s0"});
+
+    ShortlexEnumerator it(dfa, {'a', 'b'}, 80);
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.current(), "");
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.current(), "a" + std::string(60, 'b'));
+    EXPECT_FALSE(it.next());
+}
+
+TEST(ShuffleDFATest, EveryKernelMatchesTableWalk) {
+    // Random partial DFA with 15 states over 'a'..'f', so runs also fall into the dead row
+    std::mt19937 rng(21);
+    Transition t;
+    for (int i = 0; i < 15; ++i) {
+        for (char c = 'a'; c <= 'f'; ++c) {
+            if (rng() % 8 != 0) {
+                t.addTransition("q" + std::to_string(i), c, "q" + std::to_string(rng() % 15));
+            }
+        }
+    }
+    CompiledDFA dfa(t, "q0", {"q3", "q7"});
+    ASSERT_TRUE(ShuffleDFA::fits(dfa));
+    ASSERT_NE(dfa.getShuffleDFA(), nullptr);
+
+    for (ShuffleDFA::Kernel kernel : {ShuffleDFA::Kernel::Scalar, ShuffleDFA::Kernel::Sse42,
+                                      ShuffleDFA::Kernel::Avx2, ShuffleDFA::Kernel::Neon}) {
+        if (!ShuffleDFA::isSupported(kernel)) continue;
+        ShuffleDFA shuffle(dfa, kernel);
+        for (size_t length : {0, 1, 7, 31, 32, 33, 63, 100, 257, 1000}) {
+            std::string input(length, 'a');
+            for (char &c : input) c = static_cast<char>('a' + rng() % 7); // 'g' has no transition
+            for (std::uint32_t start = 0; start < dfa.getStateCount(); ++start) {
+                ASSERT_EQ(shuffle.run(start, input.data(), input.size()),
+                          dfa.runTable(start, input.data(), input.size()))
+                    << ShuffleDFA::kernelName(kernel) << " length " << length << " start " << start;
+            }
+        }
+    }
+}
+
+TEST(ShuffleDFATest, LargeAutomataKeepTableWalk) {
+    Transition t;
+    for (int i = 0; i < 20; ++i) t.addTransition("q" + std::to_string(i), 'a', "q" + std::to_string(i + 1));
+    CompiledDFA dfa(t, "q0", {"q20"});
+    EXPECT_FALSE(ShuffleDFA::fits(dfa));
+    EXPECT_EQ(dfa.getShuffleDFA(), nullptr);
+    EXPECT_THROW(ShuffleDFA shuffle(dfa), std::invalid_argument);
+    EXPECT_TRUE(dfa.accepts(std::string(20, 'a')));
+    EXPECT_FALSE(dfa.accepts(std::string(21, 'a')));
+}
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "AdP.h"
+
+// PDA for { a^n b^n : n >= 0 }, accepting by final state
+class PDATest : public ::testing::Test {
+protected:
+    PDA anbn{"q0", 'Z'};
+
+    void SetUp() override {
+        anbn.addTransition({"q0", 'a', 'Z', "AZ", "q0"});
+        anbn.addTransition({"q0", 'a', 'A', "AA", "q0"});
+        anbn.addTransition({"q0", '\0', '\0', "", "q1"});
+        anbn.addTransition({"q1", 'b', 'A', "", "q1"});
+        anbn.addTransition({"q1", '\0', 'Z', "Z", "q2"});
+        anbn.addFinalState("q2");
+    }
+};
+
+TEST_F(PDATest, AcceptsBalancedStrings) {
+    for (const std::string s : {"", "ab", "aabb", "aaabbb"}) {
+        EXPECT_TRUE(anbn.accepts(s)) << s;
+    }
+    for (const std::string s : {"a", "b", "ba", "aab", "abb", "abab", "aabbb"}) {
+        EXPECT_FALSE(anbn.accepts(s)) << s;
+    }
+}
+
+TEST_F(PDATest, PathRecordsEveryStep) {
+    std::vector<PDA_Step> path;
+    ASSERT_TRUE(anbn.accepts("aabb", &path));
+    ASSERT_EQ(path.size(), 6u);
+
+    EXPECT_EQ(path[0].fromState, "q0");
+    EXPECT_EQ(path[0].consumed, 'a');
+    EXPECT_EQ(path[0].popped, 'Z');
+    EXPECT_EQ(path[0].pushed, "AZ");
+    EXPECT_EQ(path[0].stackSnapshot, "AZ");
+    EXPECT_EQ(path[1].stackSnapshot, "AAZ");
+    EXPECT_EQ(path[2].toState, "q1");
+    EXPECT_EQ(path[2].consumed, '\0');
+    EXPECT_EQ(path[3].stackSnapshot, "AZ");
+    EXPECT_EQ(path[4].stackSnapshot, "Z");
+    EXPECT_EQ(path[5].toState, "q2");
+    EXPECT_EQ(path[5].inputIndex, 4);
+}
+
+TEST(PDAIndexTest, CandidatesKeepInsertionOrder) {
+    // Both moves from q0 accept "a"; the search must take the one added first,
+    // even though it lives in a different (input, pop) group of the index
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", '\0', '\0', "", "e"});
+    pda.addTransition({"q0", 'a', 'Z', "", "direct"});
+    pda.addTransition({"e", 'a', '\0', "", "viaEpsilon"});
+    pda.addFinalState("direct");
+    pda.addFinalState("viaEpsilon");
+
+    std::vector<PDA_Step> path;
+    ASSERT_TRUE(pda.accepts("a", &path));
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(path.back().toState, "viaEpsilon");
+}
+
+TEST(PDAIndexTest, TransitionsAddedAfterASearchAreUsed) {
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", 'a', 'Z', "Z", "q0"});
+    pda.addFinalState("q1");
+    EXPECT_FALSE(pda.accepts("ab"));
+
+    pda.addTransition({"q0", 'b', 'Z', "Z", "q1"});
+    EXPECT_TRUE(pda.accepts("ab"));
+}
+
+TEST(PDAIndexTest, PopOnlyMatchesTheTopSymbol) {
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", 'a', 'X', "", "q1"});  // X is never on the stack
+    pda.addTransition({"q0", 'b', 'Z', "", "q1"});
+    pda.addTransition({"q1", 'c', '\0', "", "q1"}); // no pop works on an empty stack
+    pda.addFinalState("q1");
+    EXPECT_FALSE(pda.accepts("a"));
+    EXPECT_TRUE(pda.accepts("b"));
+    EXPECT_TRUE(pda.accepts("bcc"));
+}
+
+TEST(PDAIndexTest, PruningKeepsTheLanguage) {
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", 'a', 'Z', "Z", "q1"});
+    pda.addTransition({"q0", 'b', 'Z', "Z", "trap"});
+    pda.addTransition({"trap", 'a', 'Z', "Z", "trap"});
+    pda.addTransition({"orphan", 'a', 'Z', "Z", "q1"});
+    pda.addFinalState("q1");
+    EXPECT_TRUE(pda.accepts("a"));
+
+    std::set<std::string> removed = pda.pruneUselessStates();
+    EXPECT_EQ(removed, (std::set<std::string>{"orphan", "trap"}));
+    EXPECT_TRUE(pda.accepts("a"));
+    EXPECT_FALSE(pda.accepts("b"));
+}
+
+TEST_F(PDATest, PathIsOnlyWrittenOnAcceptance) {
+    std::vector<PDA_Step> path(1);
+    path[0].toState = "untouched";
+    EXPECT_FALSE(anbn.accepts("aab", &path));
+    ASSERT_EQ(path.size(), 1u);
+    EXPECT_EQ(path[0].toState, "untouched");
+
+    // The path of a search that backtracked only holds the accepting branch
+    EXPECT_TRUE(anbn.accepts("ab", &path));
+    ASSERT_EQ(path.size(), 4u);
+    EXPECT_EQ(path.front().stackSnapshot, "AZ");
+    EXPECT_EQ(path.back().stackSnapshot, "Z");
+}
+
+TEST(PDASearchTest, StrategiesAgreeOnTheLanguage) {
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", 'a', 'Z', "AZ", "q0"});
+    pda.addTransition({"q0", 'a', 'A', "AA", "q0"});
+    pda.addTransition({"q0", '\0', '\0', "", "q1"});
+    pda.addTransition({"q1", 'b', 'A', "", "q1"});
+    pda.addTransition({"q1", '\0', 'Z', "Z", "q2"});
+    pda.addFinalState("q2");
+
+    for (PDA_SearchStrategy strategy : {PDA_SearchStrategy::DepthFirst, PDA_SearchStrategy::BreadthFirst,
+                                        PDA_SearchStrategy::IterativeDeepening}) {
+        PDA_SearchOptions options;
+        options.strategy = strategy;
+        for (const std::string s : {"", "ab", "aaabbb"}) {
+            PDA_SearchResult r = pda.search(s, options);
+            EXPECT_TRUE(r.accepted) << s;
+            EXPECT_FALSE(r.limitReached) << s;
+        }
+        for (const std::string s : {"a", "ba", "aabbb"}) {
+            PDA_SearchResult r = pda.search(s, options);
+            EXPECT_FALSE(r.accepted) << s;
+            EXPECT_FALSE(r.limitReached) << s; // every branch was explored: the rejection is exact
+        }
+    }
+}
+
+TEST(PDASearchTest, BreadthFirstAndIterativeDeepeningFindTheShortestPath) {
+    // The long route is added first, so depth-first takes it
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", '\0', '\0', "", "a1"});
+    pda.addTransition({"a1", '\0', '\0', "", "a2"});
+    pda.addTransition({"a2", '\0', '\0', "", "a3"});
+    pda.addTransition({"a3", 'x', '\0', "", "f"});
+    pda.addTransition({"q0", 'x', '\0', "", "f"});
+    pda.addFinalState("f");
+
+    std::vector<PDA_Step> path;
+    PDA_SearchOptions options;
+    ASSERT_TRUE(pda.search("x", options, &path).accepted);
+    EXPECT_EQ(path.size(), 4u);
+
+    options.strategy = PDA_SearchStrategy::BreadthFirst;
+    ASSERT_TRUE(pda.search("x", options, &path).accepted);
+    ASSERT_EQ(path.size(), 1u);
+    EXPECT_EQ(path[0].fromState, "q0");
+
+    options.strategy = PDA_SearchStrategy::IterativeDeepening;
+    ASSERT_TRUE(pda.search("x", options, &path).accepted);
+    EXPECT_EQ(path.size(), 1u);
+}
+
+TEST(PDASearchTest, DeepInputsDoNotRecurse) {
+    // 2n + 2 configurations deep; the old recursive search used one native frame per step
+    const int n = 200000;
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", 'a', '\0', "A", "q0"});
+    pda.addTransition({"q0", 'b', 'A', "", "q1"});
+    pda.addTransition({"q1", 'b', 'A', "", "q1"});
+    pda.addTransition({"q1", '\0', 'Z', "Z", "f"});
+    pda.addFinalState("f");
+
+    PDA_SearchOptions options;
+    options.maxSteps = 1000000;
+    std::string input = std::string(n, 'a') + std::string(n, 'b');
+    PDA_SearchResult r = pda.search(input, options);
+    EXPECT_TRUE(r.accepted);
+    EXPECT_EQ(r.steps, 2 * n + 2);
+}
+
+TEST(PDASearchTest, LimitsStopEpsilonLoops) {
+    // q0 keeps pushing on ε and never reads the input
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", '\0', '\0', "X", "q0"});
+    pda.addTransition({"q0", 'a', 'Z', "", "f"});
+    pda.addFinalState("f");
+
+    PDA_SearchOptions options;
+    options.maxSteps = 1000;
+    PDA_SearchResult r = pda.search("a", options);
+    EXPECT_FALSE(r.accepted);
+    EXPECT_TRUE(r.limitReached);
+    EXPECT_EQ(r.steps, 1000);
+
+    options.maxSteps = 1000000;
+    options.maxConfigurations = 500;
+    r = pda.search("a", options);
+    EXPECT_TRUE(r.limitReached);
+    EXPECT_LE(r.peakConfigurations, 501u);
+
+    // Breadth-first still reaches the move that reads 'a' before the loop
+    options.strategy = PDA_SearchStrategy::BreadthFirst;
+    r = pda.search("a", options);
+    EXPECT_TRUE(r.accepted);
+}
+
+TEST(PDAMemoTest, EpsilonCyclesGiveAnExactAnswer) {
+    // q0 and q1 bounce on ε without touching the stack; only q1 can read 'a'
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", '\0', '\0', "", "q1"});
+    pda.addTransition({"q1", '\0', '\0', "", "q0"});
+    pda.addTransition({"q1", 'a', 'Z', "Z", "f"});
+    pda.addFinalState("f");
+
+    PDA_SearchOptions options;
+    PDA_SearchResult r = pda.search("b", options);
+    EXPECT_FALSE(r.accepted);
+    EXPECT_FALSE(r.limitReached); // the rejection is exact, not a spent budget
+    EXPECT_LE(r.steps, 3);
+    EXPECT_GE(r.prunedConfigurations, 1u);
+    EXPECT_TRUE(pda.search("a", options).accepted);
+
+    // Without the table the search cycles until the budget runs out
+    options.memoize = false;
+    options.maxSteps = 5000;
+    r = pda.search("b", options);
+    EXPECT_FALSE(r.accepted);
+    EXPECT_TRUE(r.limitReached);
+    EXPECT_EQ(r.steps, 5000);
+}
+
+TEST(PDAMemoTest, ConvergingPathsAreExploredOnce) {
+    // 20 ε-diamonds in a row: 2^20 paths, but only 61 distinct configurations
+    PDA pda("d0", 'Z');
+    for (int i = 0; i < 20; ++i) {
+        std::string from = "d" + std::to_string(i), to = "d" + std::to_string(i + 1);
+        pda.addTransition({from, '\0', '\0', "", from + "l"});
+        pda.addTransition({from, '\0', '\0', "", from + "r"});
+        pda.addTransition({from + "l", '\0', '\0', "", to});
+        pda.addTransition({from + "r", '\0', '\0', "", to});
+    }
+    pda.addTransition({"d20", 'a', 'Z', "Z", "f"});
+    pda.addFinalState("f");
+
+    for (PDA_SearchStrategy strategy : {PDA_SearchStrategy::DepthFirst, PDA_SearchStrategy::BreadthFirst}) {
+        PDA_SearchOptions options;
+        options.strategy = strategy;
+        PDA_SearchResult r = pda.search("b", options);
+        EXPECT_FALSE(r.accepted);
+        EXPECT_FALSE(r.limitReached);
+        EXPECT_EQ(r.steps, 61);
+        EXPECT_TRUE(pda.search("a", options).accepted);
+    }
+}
+
+TEST(PDAMemoTest, EqualStacksBuiltApartAreOneConfiguration) {
+    // Popping A and pushing it back rebuilds the same stack, so the second
+    // visit of (q0, 0, AZ) is pruned instead of looping
+    PDA pda("q0", 'Z');
+    pda.addTransition({"q0", '\0', 'Z', "AZ", "q0"});
+    pda.addTransition({"q0", '\0', 'A', "A", "q0"});
+    pda.addTransition({"q0", 'x', 'A', "", "f"});
+    pda.addFinalState("f");
+
+    PDA_SearchResult r = pda.search("y");
+    EXPECT_FALSE(r.accepted);
+    EXPECT_FALSE(r.limitReached);
+    EXPECT_EQ(r.steps, 2);
+
+    std::vector<PDA_Step> path;
+    PDA_SearchOptions options;
+    options.strategy = PDA_SearchStrategy::IterativeDeepening;
+    ASSERT_TRUE(pda.search("x", options, &path).accepted);
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(path[0].stackSnapshot, "AZ");
+    EXPECT_EQ(path[1].stackSnapshot, "Z");
+}
+
+TEST(PDAMemoTest, MemoizationKeepsTheLanguage) {
+    // Even palindromes over {a, b}: the middle is guessed on ε, so branches
+    // that consume the same input meet again
+    PDA pda("push", 'Z');
+    for (char letter : {'a', 'b'}) {
+        for (char top : {'Z', 'a', 'b'}) pda.addTransition({"push", letter, top, std::string{letter, top}, "push"});
+        pda.addTransition({"pop", letter, letter, "", "pop"});
+    }
+    pda.addTransition({"push", '\0', '\0', "", "pop"});
+    pda.addTransition({"pop", '\0', 'Z', "Z", "accept"});
+    pda.addFinalState("accept");
+
+    std::vector<std::string> inputs{""};
+    for (size_t i = 0; i < inputs.size() && inputs[i].size() < 6; ++i) {
+        inputs.push_back(inputs[i] + 'a');
+        inputs.push_back(inputs[i] + 'b');
+    }
+    for (PDA_SearchStrategy strategy : {PDA_SearchStrategy::DepthFirst, PDA_SearchStrategy::BreadthFirst,
+                                        PDA_SearchStrategy::IterativeDeepening}) {
+        PDA_SearchOptions options;
+        options.strategy = strategy;
+        for (const std::string &s : inputs) {
+            bool palindrome = s.size() % 2 == 0 && std::string(s.rbegin(), s.rend()) == s;
+            options.memoize = true;
+            EXPECT_EQ(pda.search(s, options).accepted, palindrome) << s;
+            options.memoize = false;
+            EXPECT_EQ(pda.search(s, options).accepted, palindrome) << s;
+        }
+    }
+}
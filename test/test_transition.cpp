@@ -88,3 +88,90 @@ TEST(TransitionTest, NFAMultiplePaths) {
     EXPECT_EQ(r1[0], "q3");
     EXPECT_EQ(r2[0], "q3");
 }
+
+// Test 8: Interned ids round-trip through the string API
+TEST(TransitionTest, InternedStateIds) {
+    Transition t;
+    t.addTransition("q0", 'a', "q1");
+    t.addTransition("q1", 'b', "q0");
+
+    StateId q0 = t.getStateId("q0");
+    StateId q1 = t.getStateId("q1");
+    ASSERT_NE(q0, Transition::INVALID_STATE);
+    ASSERT_NE(q1, Transition::INVALID_STATE);
+    EXPECT_EQ(t.getStateCount(), 2);
+    EXPECT_EQ(t.getStateName(q0), "q0");
+    EXPECT_EQ(t.getStateName(q1), "q1");
+    EXPECT_EQ(t.internState("q1"), q1); // interning is idempotent
+    EXPECT_EQ(t.getStateId("q9"), Transition::INVALID_STATE);
+
+    const auto &next = t.getNextStates(q0, 'a');
+    ASSERT_EQ(next.size(), 1);
+    EXPECT_EQ(next[0], q1);
+    EXPECT_TRUE(t.getNextStates(q1, 'a').empty());
+}
+
+// Test 9: Id-based insertion is visible through the string API
+TEST(TransitionTest, IdBasedAddTransition) {
+    Transition t;
+    StateId a = t.internState("A");
+    StateId b = t.internState("B");
+    t.addTransition(a, 'x', b);
+    t.addTransition(a, 'x', a);
+    auto result = t.getNextStates("A", 'x');
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0], "B");
+    EXPECT_EQ(result[1], "A");
+    EXPECT_TRUE(t.getNextStates("missing", 'x').empty());
+
+    t.clear();
+    EXPECT_EQ(t.getStateCount(), 0);
+    EXPECT_EQ(t.getStateId("A"), Transition::INVALID_STATE);
+}
+
+// Test 10: getNextStateIds views the stored destinations without copying them
+TEST(TransitionTest, NextStateIdsView) {
+    Transition t;
+    t.addTransition("q0", 'a', "q1");
+    t.addTransition("q0", 'a', "q2");
+
+    StateSpan next = t.getNextStateIds("q0", 'a');
+    ASSERT_EQ(next.size(), 2);
+    EXPECT_EQ(t.getStateName(next[0]), "q1");
+    EXPECT_EQ(t.getStateName(next[1]), "q2");
+    EXPECT_EQ(next.begin(), t.getNextStates(t.getStateId("q0"), 'a').begin());
+
+    EXPECT_TRUE(t.getNextStateIds("q0", 'b').empty());
+    EXPECT_TRUE(t.getNextStateIds("missing", 'a').empty());
+}
+
+// Test 11: Destination runs survive table growth and keep insertion order
+TEST(TransitionTest, ManyTransitionsAcrossGrowth) {
+    Transition t;
+    const int states = 2000;
+    for (int i = 0; i < states; ++i) {
+        std::string from = "q" + std::to_string(i);
+        t.addTransition(from, 'a', "q" + std::to_string((i + 1) % states));
+        t.addTransition(from, 'b', from);
+    }
+    // Append to early runs after the table has been resized many times
+    for (int i = 0; i < 10; ++i) {
+        t.addTransition("q0", 'a', "q" + std::to_string(100 + i));
+    }
+
+    auto r0 = t.getNextStates("q0", 'a');
+    ASSERT_EQ(r0.size(), 11);
+    EXPECT_EQ(r0[0], "q1");
+    EXPECT_EQ(r0[10], "q109");
+    for (int i = 1; i < states; i += 97) {
+        std::string from = "q" + std::to_string(i);
+        EXPECT_EQ(t.getNextStates(from, 'a'), std::vector<std::string>{"q" + std::to_string((i + 1) % states)});
+        EXPECT_EQ(t.getNextStates(from, 'b'), std::vector<std::string>{from});
+        EXPECT_TRUE(t.getNextStates(from, 'c').empty());
+    }
+
+    size_t entries = 0;
+    t.forEachTransition([&](StateId, char, StateSpan) { ++entries; });
+    EXPECT_EQ(entries, 2 * states);
+    EXPECT_EQ(t.getSymbols(), (std::vector<char>{'a', 'b'}));
+}
@@ -2,11 +2,20 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <map>
 #include <algorithm> // For std::sort
+#include <atomic>
+#include <stdexcept>
 
 // Include the headers for the code we are testing
 #include "Transition.h"
 #include "validacion_cadenas.h"
+#include "Determinization.h"
+#include "EpsilonClosure.h"
+#include "ParallelGeneration.h"
+#include "StringSampler.h"
+#include "ThreadPool.h"
+#include "Trimming.h"
 
 // Helper function to compare two vectors of strings, ignoring element order.
 // This makes tests robust against changes in the order of results.
@@ -191,9 +200,465 @@ TEST_F(AutomataTest, GenerarConLimiteCycle_Limit2) {
     assertVectorsEqualUnordered(result, expected);
 }
 
+TEST_F(AutomataTest, GenerarConLimiteKeepsBreadthFirstOrder) {
+    // Shorter strings first; within a length, the order in which the paths are expanded
+    std::vector<std::string> expected = {"1", "01", "11", "011", "101"};
+    EXPECT_EQ(generarCadenasConLimite(cycle_automaton, cycle_initial, cycle_final, cycle_alphabet, 4, 2), expected);
+}
+
 TEST_F(AutomataTest, GenerarConLimiteCycle_Limit1) {
     // A cycle limit of 1 means a state cannot be revisited. Effectively, no cycles allowed.
     std::vector<std::string> expected = {"1"};
     auto result = generarCadenasConLimite(cycle_automaton, cycle_initial, cycle_final, cycle_alphabet, 4, 1);
     assertVectorsEqualUnordered(result, expected);
-}
\ No newline at end of file
+}
+
+// --- 🧪 Tests for NFASimulator ---
+// The bitset simulator must agree with validarCadena on every automaton.
+//--------------------------------------------------------------------------------
+
+TEST_F(AutomataTest, NFASimulatorMatchesValidarCadena) {
+    NFASimulator sim(nfa, nfa_initial, nfa_final);
+    for (const std::string s : {"", "a", "aa", "ab", "aab", "abb", "b", "aaab"}) {
+        std::set<std::string> expected = validarCadena(nfa, nfa_initial, s);
+        StateBitset reached = sim.run(s);
+        std::set<std::string> actual;
+        reached.forEach([&](StateId id) { actual.insert(nfa.getStateName(id)); });
+        EXPECT_EQ(actual, expected) << s;
+        EXPECT_EQ(esAceptada(sim, s), esAceptada(nfa, nfa_initial, nfa_final, s)) << s;
+    }
+}
+
+TEST_F(AutomataTest, NFASimulatorCycleAndEmpty) {
+    NFASimulator cycles(cycle_automaton, cycle_initial, cycle_final);
+    EXPECT_TRUE(cycles.accepts("0101"));
+    EXPECT_FALSE(cycles.accepts("0110"));
+    EXPECT_FALSE(cycles.accepts("012"));
+
+    NFASimulator empty(empty_string_automaton, empty_initial, empty_final);
+    EXPECT_TRUE(empty.accepts(""));
+    EXPECT_FALSE(empty.accepts("a"));
+}
+
+TEST(NFASimulatorTest, WideNFAStateSetSpansSeveralWords) {
+    // q0 fans out to 130 states on 'a'; every one of them loops back on 'b'
+    Transition t;
+    for (int i = 1; i <= 130; ++i) {
+        t.addTransition("q0", 'a', "s" + std::to_string(i));
+        t.addTransition("s" + std::to_string(i), 'b', "q0");
+    }
+    NFASimulator sim(t, "q0", {"s130"});
+    EXPECT_EQ(sim.run("a").count(), 130);
+    EXPECT_EQ(sim.run("ab").count(), 1);
+    EXPECT_TRUE(sim.accepts("aba"));
+    EXPECT_FALSE(sim.accepts("abab"));
+}
+
+//--------------------------------------------------------------------------------
+// --- 🧪 Tests for epsilon transitions ---
+// Transition::EPSILON moves are followed without consuming input, by every engine.
+//--------------------------------------------------------------------------------
+
+// (a|b)*abb built with ε-moves, Thompson style, including an ε-cycle q1 <-> q2
+static Transition epsilonAutomaton() {
+    Transition t;
+    t.addTransition("q0", Transition::EPSILON, "q1");
+    t.addTransition("q1", Transition::EPSILON, "q2");
+    t.addTransition("q2", Transition::EPSILON, "q1");
+    t.addTransition("q1", 'a', "q1");
+    t.addTransition("q2", 'b', "q2");
+    t.addTransition("q2", Transition::EPSILON, "q3");
+    t.addTransition("q3", 'a', "q4");
+    t.addTransition("q4", 'b', "q5");
+    t.addTransition("q5", 'b', "q6");
+    t.addTransition("q6", Transition::EPSILON, "q7");
+    return t;
+}
+
+TEST(EpsilonTest, ClosuresFollowChainsAndCycles) {
+    Transition t = epsilonAutomaton();
+    EXPECT_TRUE(t.hasEpsilonTransitions());
+
+    EpsilonClosure closure(t);
+    EXPECT_FALSE(closure.isTrivial());
+    StateBitset fromStart(t.getStateCount());
+    closure.addClosure(t.getStateId("q0"), fromStart);
+    std::set<std::string> names;
+    fromStart.forEach([&](StateId id) { names.insert(t.getStateName(id)); });
+    EXPECT_EQ(names, (std::set<std::string>{"q0", "q1", "q2", "q3"}));
+
+    StateBitset fromQ4(t.getStateCount());
+    closure.addClosure(t.getStateId("q4"), fromQ4);
+    EXPECT_EQ(fromQ4.count(), 1);
+}
+
+TEST(EpsilonTest, ValidationFollowsEpsilonMoves) {
+    Transition t = epsilonAutomaton();
+    std::set<std::string> finals = {"q7"};
+
+    EXPECT_EQ(validarCadena(t, "q0", ""), (std::set<std::string>{"q0", "q1", "q2", "q3"}));
+    EXPECT_EQ(validarCadena(t, "q0", "abb"),
+              (std::set<std::string>{"q1", "q2", "q3", "q6", "q7"}));
+
+    NFASimulator sim(t, "q0", finals);
+    DeterministicAutomaton dfa = determinize(t, "q0", finals);
+    CompiledDFA compiled(dfa.delta, dfa.initialState, dfa.finalStates);
+    for (const std::string s : {"", "abb", "aabb", "babb", "ab", "abba", "bbabb", "abab"}) {
+        bool expected = s.size() >= 3 && s.compare(s.size() - 3, 3, "abb") == 0;
+        EXPECT_EQ(esAceptada(t, "q0", finals, s), expected) << s;
+        EXPECT_EQ(sim.accepts(s), expected) << s;
+        EXPECT_EQ(compiled.accepts(s), expected) << s;
+    }
+    // A NUL byte in the input is not an epsilon move
+    EXPECT_FALSE(esAceptada(t, "q0", finals, std::string("abb\0", 4)));
+}
+
+TEST(EpsilonTest, PrebuiltClosureMatchesPerCallClosure) {
+    Transition t = epsilonAutomaton();
+    std::set<std::string> finals = {"q7"};
+    const EpsilonClosure closure(t);
+
+    for (const std::string s : {"", "abb", "aabb", "babb", "ab", "abba"}) {
+        EXPECT_EQ(esAceptada(t, closure, "q0", finals, s), esAceptada(t, "q0", finals, s)) << s;
+        EXPECT_EQ(validarCadena(t, closure, "q0", s), validarCadena(t, "q0", s)) << s;
+    }
+    // Closures of a smaller automaton do not cover the new states
+    Transition grown = t;
+    grown.addTransition("q7", 'a', "q8");
+    EXPECT_THROW(esAceptada(grown, closure, "q0", finals, "abb"), std::invalid_argument);
+}
+
+TEST(EpsilonTest, GenerationFollowsEpsilonMoves) {
+    Transition t;
+    t.addTransition("q0", 'a', "q1");
+    t.addTransition("q1", Transition::EPSILON, "q2");
+    t.addTransition("q2", 'b', "q0");
+    t.addTransition("q0", Transition::EPSILON, "q3");
+    std::set<std::string> finals = {"q3"};
+
+    // Language (ab)*, accepted through the ε-move q0 -> q3
+    assertVectorsEqualUnordered(generarCadenasAceptadas(t, "q0", finals, {'a', 'b'}, 4),
+                                {"", "ab", "abab"});
+    assertVectorsEqualUnordered(generarCadenasConLimite(t, "q0", finals, {'a', 'b'}, 4, 2),
+                                {"", "ab"});
+}
+
+//--------------------------------------------------------------------------------
+// --- 🧪 Tests for batch validation ---
+// esAceptadaLote must set exactly the bits of the strings esAceptada accepts.
+//--------------------------------------------------------------------------------
+
+TEST_F(AutomataTest, BatchMatchesEsAceptada) {
+    // 1000 strings: not a multiple of 64, and more than one block per thread
+    std::vector<std::string> cadenas;
+    for (int i = 0; i < 1000; ++i) {
+        std::string s;
+        for (int n = i; n > 0; n /= 3) s += "ab"[n % 3 == 2];
+        cadenas.push_back(s);
+    }
+
+    ThreadPool pool(4);
+    NFASimulator sim(nfa, nfa_initial, nfa_final);
+    std::vector<std::uint64_t> porSimulador = esAceptadaLote(sim, cadenas.data(), cadenas.size(), pool);
+    std::vector<std::uint64_t> porAutomata = esAceptadaLote(nfa, nfa_initial, nfa_final, cadenas);
+    ASSERT_EQ(porSimulador.size(), (cadenas.size() + 63) / 64);
+    EXPECT_EQ(porSimulador, porAutomata);
+    for (size_t i = 0; i < cadenas.size(); ++i) {
+        EXPECT_EQ(aceptadaEnLote(porSimulador, i), esAceptada(nfa, nfa_initial, nfa_final, cadenas[i])) << cadenas[i];
+    }
+    // Bits past the end of the batch stay clear
+    EXPECT_EQ(porSimulador.back() >> (cadenas.size() % 64), 0u);
+
+    EXPECT_TRUE(esAceptadaLote(sim, cadenas.data(), 0, pool).empty());
+}
+
+TEST(ThreadPoolTest, RunsEveryIndexOnceAndRethrows) {
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.getThreadCount(), 3u);
+
+    std::vector<std::atomic<int>> hits(500);
+    pool.parallelFor(hits.size(), [&](size_t i) { hits[i]++; });
+    for (auto &h : hits) EXPECT_EQ(h.load(), 1);
+
+    EXPECT_THROW(pool.parallelFor(10, [](size_t i) {
+        if (i == 7) throw std::runtime_error("task failed");
+    }), std::runtime_error);
+
+    // The pool is still usable after a failure
+    std::atomic<int> total{0};
+    pool.parallelFor(100, [&](size_t) { total++; });
+    EXPECT_EQ(total.load(), 100);
+}
+
+//--------------------------------------------------------------------------------
+// --- 🧪 Tests for the lazy DFA backend ---
+//--------------------------------------------------------------------------------
+
+TEST_F(AutomataTest, LazyDFAMatchesEsAceptadaAndCaches) {
+    LazyDFA lazy(nfa, nfa_initial, nfa_final);
+    const std::vector<std::string> inputs = {"", "a", "ab", "aab", "aaab", "abb", "b", "ba"};
+    for (const std::string &s : inputs) {
+        EXPECT_EQ(esAceptada(lazy, s), esAceptada(nfa, nfa_initial, nfa_final, s)) << s;
+    }
+    LazyDFA::Stats first = lazy.getStats();
+    EXPECT_GT(first.misses, 0u);
+    EXPECT_EQ(first.flushes, 0u);
+
+    // Every transition needed by the same inputs is now cached
+    lazy.resetStats();
+    for (const std::string &s : inputs) lazy.accepts(s);
+    EXPECT_EQ(lazy.getStats().misses, 0u);
+    EXPECT_GT(lazy.getStats().hits, 0u);
+
+    for (const std::string &s : inputs) {
+        for (MotorValidacion motor : {MotorValidacion::Simulacion, MotorValidacion::Compilado,
+                                      MotorValidacion::Perezoso}) {
+            EXPECT_EQ(esAceptada(nfa, nfa_initial, nfa_final, s, motor),
+                      esAceptada(nfa, nfa_initial, nfa_final, s)) << s;
+        }
+    }
+}
+
+TEST(LazyDFATest, TinyBudgetFlushesButStaysCorrect) {
+    // "the 8th symbol from the end is 'a'": 2^8 DFA states
+    Transition t;
+    t.addTransition("p0", 'a', "p0");
+    t.addTransition("p0", 'b', "p0");
+    t.addTransition("p0", 'a', "p1");
+    for (int i = 1; i < 8; ++i) {
+        t.addTransition("p" + std::to_string(i), 'a', "p" + std::to_string(i + 1));
+        t.addTransition("p" + std::to_string(i), 'b', "p" + std::to_string(i + 1));
+    }
+    LazyDFA lazy(t, "p0", {"p8"}, 1024);
+
+    std::string input;
+    unsigned seed = 12345;
+    for (int i = 0; i < 600; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        input += "ab"[(seed >> 16) & 1];
+        EXPECT_EQ(lazy.accepts(input), esAceptada(t, "p0", {"p8"}, input)) << i;
+    }
+    EXPECT_GT(lazy.getStats().flushes, 0u);
+    EXPECT_LE(lazy.getMemoryUsage(), lazy.getMemoryBudget());
+}
+
+//--------------------------------------------------------------------------------
+// --- 🧪 Tests for contarCadenasAceptadas ---
+//--------------------------------------------------------------------------------
+
+TEST_F(AutomataTest, ContarMatchesGenerar) {
+    const int maxLength = 8;
+    std::vector<BigCount> counts = contarCadenasAceptadas(nfa, nfa_initial, nfa_final, maxLength);
+    ASSERT_EQ(counts.size(), maxLength + 1u);
+
+    std::vector<std::uint64_t> expected(maxLength + 1, 0);
+    for (const std::string &s : generarCadenasAceptadas(nfa, nfa_initial, nfa_final, nfa_alphabet, maxLength)) {
+        expected[s.size()]++;
+    }
+    for (int k = 0; k <= maxLength; ++k) {
+        EXPECT_EQ(counts[k], BigCount(expected[k])) << k;
+    }
+}
+
+TEST_F(AutomataTest, ContarLongLengthsIsExact) {
+    // Strings over {0,1} ending in '1': 2^(k-1) of length k
+    std::vector<BigCount> counts = contarCadenasAceptadas(cycle_automaton, cycle_initial, cycle_final, 100);
+    EXPECT_TRUE(counts[0].isZero());
+    EXPECT_EQ(counts[1].toString(), "1");
+    EXPECT_EQ(counts[64].toString(), "9223372036854775808");
+    EXPECT_EQ(counts[100].toString(), "633825300114114700748351602688");
+
+    std::vector<BigCount> none = contarCadenasAceptadas(empty_string_automaton, empty_initial, empty_final, 3);
+    EXPECT_EQ(none[0], BigCount(1));
+    EXPECT_TRUE(none[3].isZero());
+}
+
+TEST(BigCountTest, Arithmetic) {
+    BigCount a(0xFFFFFFFFFFFFFFFFull);
+    a += BigCount(1);
+    EXPECT_EQ(a.toString(), "18446744073709551616");
+    EXPECT_EQ(a.bitLength(), 65u);
+
+    BigCount b;
+    b.addProduct(a, 1000000000u);
+    EXPECT_EQ(b.toString(), "18446744073709551616000000000");
+    b -= a;
+    EXPECT_EQ(b.toString(), "18446744055262807542290448384");
+    EXPECT_TRUE(a < b);
+    EXPECT_FALSE(b < a);
+    EXPECT_EQ(BigCount().toString(), "0");
+
+    EXPECT_EQ(b.divideSmall(1000), 384u);
+    EXPECT_EQ(b.toString(), "18446744055262807542290448");
+    BigCount small(7);
+    EXPECT_EQ(small.divideSmall(8), 7u);
+    EXPECT_TRUE(small.isZero());
+}
+
+//--------------------------------------------------------------------------------
+// --- 🧪 Tests for muestrearCadenasAceptadas ---
+//--------------------------------------------------------------------------------
+
+TEST_F(AutomataTest, MuestrearIsUniformAndReproducible) {
+    // Strings of length 4 ending in '1': 8 of them, each should appear ~1/8 of the time
+    std::vector<std::string> samples = muestrearCadenasAceptadas(cycle_automaton, cycle_initial, cycle_final, 4, 8000, 7);
+    ASSERT_EQ(samples.size(), 8000u);
+    std::map<std::string, int> histogram;
+    for (const std::string &s : samples) {
+        EXPECT_EQ(s.size(), 4u);
+        EXPECT_TRUE(esAceptada(cycle_automaton, cycle_initial, cycle_final, s)) << s;
+        histogram[s]++;
+    }
+    EXPECT_EQ(histogram.size(), 8u);
+    for (const auto &entry : histogram) {
+        EXPECT_NEAR(entry.second, 1000, 150) << entry.first;
+    }
+
+    EXPECT_EQ(muestrearCadenasAceptadas(cycle_automaton, cycle_initial, cycle_final, 4, 8000, 7), samples);
+}
+
+TEST_F(AutomataTest, MuestrearLongAndEmptyLanguages) {
+    std::vector<std::string> longOnes = muestrearCadenasAceptadas(nfa, nfa_initial, nfa_final, 500, 3, 1);
+    ASSERT_EQ(longOnes.size(), 3u);
+    EXPECT_EQ(longOnes[0], std::string(499, 'a') + "b");
+
+    // a+b has no string of length 1
+    EXPECT_TRUE(muestrearCadenasAceptadas(nfa, nfa_initial, nfa_final, 1, 5, 1).empty());
+
+    std::vector<std::string> empty = muestrearCadenasAceptadas(empty_string_automaton, empty_initial, empty_final, 0, 2, 3);
+    EXPECT_EQ(empty, std::vector<std::string>({"", ""}));
+}
+
+static CompiledDFA compileForSampling(const Transition &t, const std::set<std::string> &finals) {
+    DeterministicAutomaton dfa = determinize(t, "q0", finals);
+    return CompiledDFA(dfa.delta, dfa.initialState, dfa.finalStates);
+}
+
+TEST(StringSamplerTest, BytesSharingATargetAreEquallyLikely) {
+    // [a-d] then x or [a-d][a-d]: three rows, one move carrying four bytes
+    Transition t;
+    for (char c : {'a', 'b', 'c', 'd'}) {
+        t.addTransition("q0", c, "q1");
+        t.addTransition("q1", c, "q2");
+    }
+    t.addTransition("q1", 'x', "q2");
+    t.addTransition("q0", 'z', "dead"); // never reaches an accepting row
+    StringSampler sampler(compileForSampling(t, {"q2"}), 2);
+    EXPECT_EQ(sampler.getCount().toString(), "20");
+
+    std::mt19937_64 rng(11);
+    std::map<std::string, int> histogram;
+    for (int i = 0; i < 20000; ++i) histogram[sampler.sample(rng)]++;
+    EXPECT_EQ(histogram.size(), 20u);
+    for (const auto &entry : histogram) {
+        EXPECT_NE(entry.first[0], 'z');
+        EXPECT_NEAR(entry.second, 1000, 150) << entry.first;
+    }
+}
+
+TEST(StringSamplerTest, TableOverBudgetThrows) {
+    Transition t;
+    for (char c = 'a'; c <= 'z'; ++c) t.addTransition("q0", c, "q0");
+    CompiledDFA dfa = compileForSampling(t, {"q0"});
+    EXPECT_THROW(StringSampler(dfa, 100000, std::size_t(1) << 20), std::length_error);
+
+    StringSampler sampler(dfa, 1000);
+    EXPECT_EQ(sampler.getCount().bitLength(), 4701u); // 26^1000
+    EXPECT_LT(sampler.getTableBytes(), std::size_t(1) << 20);
+}
+
+//--------------------------------------------------------------------------------
+// --- 🧪 Tests for trimAutomaton ---
+//--------------------------------------------------------------------------------
+
+TEST(TrimmingTest, DropsUnreachableAndDeadStates) {
+    Transition t;
+    t.addTransition("q0", 'a', "q1");
+    t.addTransition("q1", 'b', "q2");
+    t.addTransition("q0", 'b', "trap");      // dead: never reaches q2
+    t.addTransition("trap", 'a', "trap");
+    t.addTransition("island", 'a', "q2");    // unreachable from q0
+    t.addTransition("q1", Transition::EPSILON, "q2");
+
+    TrimmedAutomaton trimmed = trimAutomaton(t, "q0", {"q2"});
+    EXPECT_EQ(trimmed.usefulStates, (std::set<std::string>{"q0", "q1", "q2"}));
+    EXPECT_EQ(trimmed.removedStates, (std::set<std::string>{"trap", "island"}));
+    EXPECT_TRUE(trimmed.delta.getNextStateIds("q0", 'b').empty());
+    EXPECT_EQ(trimmed.delta.getNextStates("q1", Transition::EPSILON), std::vector<std::string>{"q2"});
+
+    for (const std::string s : {"", "a", "ab", "b", "ba", "aab"}) {
+        EXPECT_EQ(esAceptada(trimmed.delta, "q0", {"q2"}, s), esAceptada(t, "q0", {"q2"}, s)) << s;
+    }
+}
+
+TEST(TrimmingTest, EmptyLanguageAndIsolatedInitial) {
+    Transition t;
+    t.addTransition("q0", 'a', "q1");
+    TrimmedAutomaton none = trimAutomaton(t, "q0", {"q9"});
+    EXPECT_EQ(none.delta.getStateCount(), 0u);
+    EXPECT_TRUE(none.usefulStates.empty());
+
+    TrimmedAutomaton onlyEmpty = trimAutomaton(t, "start", {"start"});
+    EXPECT_EQ(onlyEmpty.usefulStates, std::set<std::string>{"start"});
+    EXPECT_TRUE(esAceptada(onlyEmpty.delta, "start", {"start"}, ""));
+}
+
+TEST_F(AutomataTest, GenerationIgnoresDeadBranches) {
+    // A dead branch with a self-loop must not change the results
+    Transition withTrap = cycle_automaton;
+    withTrap.addTransition("S", '2', "trap");
+    withTrap.addTransition("trap", '0', "trap");
+    std::vector<char> alphabet = {'0', '1', '2'};
+    assertVectorsEqualUnordered(generarCadenasConLimite(withTrap, cycle_initial, cycle_final, alphabet, 4, 2),
+                                generarCadenasConLimite(cycle_automaton, cycle_initial, cycle_final, alphabet, 4, 2));
+}
+
+//--------------------------------------------------------------------------------
+// --- 🧪 Tests for generarCadenasAceptadasParalelo ---
+//--------------------------------------------------------------------------------
+
+TEST_F(AutomataTest, ParallelGenerationMatchesSequentialOrder) {
+    // Identifiers over {a, b, 0}: a letter followed by letters or digits, plus a dead branch
+    Transition t;
+    t.addTransition("S", 'a', "I");
+    t.addTransition("S", 'b', "I");
+    t.addTransition("S", '0', "trap");
+    for (char c : {'a', 'b', '0'}) t.addTransition("I", c, "I");
+    const std::vector<char> alphabet = {'0', 'a', 'b'};
+    std::vector<std::string> sequential = generarCadenasAceptadas(t, "S", {"I"}, alphabet, 7);
+
+    ThreadPool pool(4);
+    EXPECT_EQ(generarCadenasAceptadasParalelo(t, "S", {"I"}, alphabet, 7, pool), sequential);
+
+    // Every split depth, including none and the full length, gives the same list
+    DeterministicAutomaton d = determinize(t, "S", {"I"});
+    CompiledDFA dfa(d.delta, d.initialState, d.finalStates);
+    for (size_t depth = 0; depth <= 8; ++depth) {
+        EXPECT_EQ(generateShortlexParallel(dfa, alphabet, 7, pool, depth), sequential) << depth;
+    }
+
+    EXPECT_EQ(generarCadenasAceptadasParalelo(nfa, nfa_initial, nfa_final, nfa_alphabet, 5, pool),
+              generarCadenasAceptadas(nfa, nfa_initial, nfa_final, nfa_alphabet, 5));
+    EXPECT_EQ(generarCadenasAceptadasParalelo(empty_string_automaton, empty_initial, empty_final, empty_alphabet, 3, pool),
+              std::vector<std::string>{""});
+}
+
+TEST(ParallelGenerationTest, FallsBackWhenDeterminizationHitsTheCap) {
+    // 17th symbol from the end is 'a': the subset construction needs 2^17 states,
+    // over DEFAULT_MAX_DFA_STATES. A 'c' branch gives a few short accepted strings.
+    Transition t;
+    t.addTransition("q0", 'a', "q0");
+    t.addTransition("q0", 'b', "q0");
+    t.addTransition("q0", 'a', "p1");
+    for (int i = 1; i < 17; ++i) {
+        for (char c : {'a', 'b'}) t.addTransition("p" + std::to_string(i), c, "p" + std::to_string(i + 1));
+    }
+    t.addTransition("q0", 'c', "f");
+    const std::set<std::string> finals = {"p17", "f"};
+    EXPECT_THROW(determinize(t, "q0", finals), std::length_error);
+
+    ThreadPool pool(2);
+    const std::vector<char> alphabet = {'a', 'b', 'c'};
+    EXPECT_EQ(generarCadenasAceptadasParalelo(t, "q0", finals, alphabet, 2, pool),
+              (std::vector<std::string>{"c", "ac", "bc"}));
+}